@@ -9,8 +9,8 @@ describe.each<TestValue>([
     LIVEINWATER,
     TEALADY,
 ])("inClose", (value: TestValue) => {
-    test(`inClose on ${value.title}`, () => {
-        const context = parseBurmeister(value.fileContent);
+    test(`inClose on ${value.title}`, async () => {
+        const context = await parseBurmeister(value.fileContent);
         const concepts = inClose(context).value;
         expect(context.cellsPerObject).toBe(value.contextCellsPerObject);
         expect(context.objects.length).toBe(value.objectsCount);
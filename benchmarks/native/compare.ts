@@ -0,0 +1,84 @@
+// npx vite-node ./benchmarks/native/compare.ts <baseline.json> <current.json> [threshold]
+//
+// Compares two outputs of ./benchmarks/native/suite.cpp
+// and exits with a non-zero code if a benchmark got slower than the threshold (default: 0.1 ⇒ 10 %)
+
+import { readFileSync } from "fs";
+
+type BenchmarkResult = {
+    dataset: string,
+    benchmark: string,
+    concepts: number,
+    runs: number,
+    meanNs: number,
+    medianNs: number,
+    minNs: number,
+    maxNs: number,
+    stdDeviationNs: number,
+}
+
+type SuiteOutput = {
+    version: number,
+    compiler: string,
+    results: Array<BenchmarkResult>,
+}
+
+const [baselinePath, currentPath, thresholdArgument] = process.argv.slice(2);
+
+if (!baselinePath || !currentPath) {
+    console.error("Usage: compare.ts <baseline.json> <current.json> [threshold]");
+    process.exit(1);
+}
+
+const threshold = thresholdArgument ? parseFloat(thresholdArgument) : 0.1;
+const baseline = readOutput(baselinePath);
+const current = readOutput(currentPath);
+const baselineResults = new Map(baseline.results.map((result) => [resultKey(result), result]));
+let regressionsCount = 0;
+
+console.log(`Baseline: ${baseline.compiler}`);
+console.log(`Current: ${current.compiler}`);
+console.log("");
+console.log("| Dataset | Benchmark | Baseline (ms) | Current (ms) | Change |");
+console.log("| ------- | --------- | ------------: | -----------: | -----: |");
+
+for (const result of current.results) {
+    const baselineResult = baselineResults.get(resultKey(result));
+
+    if (!baselineResult) {
+        continue;
+    }
+
+    // Median is less sensitive to outliers than mean
+    const change = (result.medianNs - baselineResult.medianNs) / baselineResult.medianNs;
+    // Differences within the noise of both measurements are not considered as regressions
+    const noise = (result.stdDeviationNs + baselineResult.stdDeviationNs) / baselineResult.medianNs;
+    const isRegression = change > threshold && change > noise;
+
+    if (isRegression) {
+        regressionsCount++;
+    }
+
+    console.log(`| ${result.dataset} | ${result.benchmark} | ${toMilliseconds(baselineResult.medianNs)} | ${toMilliseconds(result.medianNs)} | ${formatChange(change)}${isRegression ? " ⚠" : ""} |`);
+}
+
+console.log("");
+console.log(`Regressions: ${regressionsCount}`);
+
+process.exit(regressionsCount > 0 ? 1 : 0);
+
+function readOutput(path: string): SuiteOutput {
+    return JSON.parse(readFileSync(path, "utf-8"));
+}
+
+function resultKey(result: BenchmarkResult) {
+    return `${result.dataset};${result.benchmark}`;
+}
+
+function toMilliseconds(nanoseconds: number) {
+    return (nanoseconds / 1_000_000).toFixed(3);
+}
+
+function formatChange(change: number) {
+    return `${change > 0 ? "+" : ""}${(change * 100).toFixed(1)} %`;
+}
\ No newline at end of file
@@ -26,7 +26,12 @@
 #include "../../src/cpp/types/TimedResult.h"
 
 #include "../../src/cpp/utils.cpp"
+#include "../../src/cpp/trace.cpp"
+#include "../../src/cpp/memory.cpp"
+#include "../../src/cpp/mappedFile.cpp"
+#include "../../src/cpp/parallel.cpp"
 #include "../../src/cpp/burmeister.cpp"
+#include "../../src/cpp/compressedExtent.cpp"
 #include "../../src/cpp/inClose.cpp"
 
 #include <stdio.h>
@@ -38,6 +43,7 @@
 #include <numeric>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
 
 struct Stats {
     double average;
@@ -72,12 +78,13 @@ Stats generateStats(const std::vector<double>& times) {
 
 
 int main(int argc, char* argv[]) {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <file_path>" << std::endl;
+    if (argc != 2 && argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <file_path> [runs_count]" << std::endl;
         return 1;
     }
 
     std::string filePath = argv[1];
+    int runsCount = argc == 3 ? std::stoi(argv[2]) : 50;
     std::string fileContent = readFileToString(filePath);
 
     if (fileContent.empty()) {
@@ -85,14 +92,17 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    FormalContext context = parseBurmeister(fileContent);
+    FormalContext context = parseBurmeister(fileContent, false);
 
     std::vector<double> times;
-    int runsCount = 50;
+    size_t conceptsCount = 0;
 
     for (int i = 0; i < runsCount; i++) {
         TimedResult<std::vector<FormalConcept>> result;
 
+        // Measured here with a sub-millisecond precision, so that small datasets can be compared too
+        auto startTime = std::chrono::steady_clock::now();
+
         inClose(
             result,
             context.getContext(),
@@ -101,12 +111,17 @@ int main(int argc, char* argv[]) {
             context.getObjects().size(),
             context.getAttributes().size());
 
-        times.push_back(result.time);
-        std::cerr << "[" << i << "] Time: " << result.time << "ms" << std::endl;
+        auto endTime = std::chrono::steady_clock::now();
+        double time = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+        conceptsCount = result.value.size();
+        times.push_back(time);
+        std::cerr << "[" << i << "] Time: " << time << "ms" << std::endl;
     }
 
     auto stats = generateStats(times);
 
+    std::cerr << "Concepts: " << conceptsCount << std::endl;
     std::cerr << "Average time: " << stats.average << "ms" << std::endl;
     std::cerr << "Standard deviation: " << stats.stdDeviation << "ms" << std::endl;
 
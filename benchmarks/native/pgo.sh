@@ -0,0 +1,138 @@
+#!/bin/bash
+
+# Profile-guided optimization (PGO) of the native benchmark
+# The WASM module is not built with a profile (see the PGO section of benchmarks/README.md)
+#
+# 1. The benchmark is compiled with instrumentation and run over the datasets to collect a profile
+# 2. The benchmark is compiled again with the collected profile
+# 3. Both builds are run over the datasets and the speedup of each dataset is written to the report
+#
+# Run from the project root:
+#   ./benchmarks/native/pgo.sh                    # GCC
+#   COMPILER=clang++ ./benchmarks/native/pgo.sh   # Clang
+#
+# The compared datasets take at least tens of milliseconds, shorter runs of InClose are dominated by the noise of the timer and of the machine.
+#
+# Environment variables:
+#   COMPILER             g++ (default) or clang++
+#   DATASETS             space separated paths to the compared datasets (default: the largest datasets in ./datasets)
+#   TRAINING_DATASETS    space separated paths to the datasets the profile is collected on (default: all .cxt files in ./datasets)
+#   TRAINING_RUNS_COUNT  runs of the instrumented benchmark per dataset (default: 1)
+#   RUNS_COUNT           runs of the compared benchmarks per dataset (default: 20)
+
+set -e
+
+COMPILER="${COMPILER:-g++}"
+TRAINING_RUNS_COUNT="${TRAINING_RUNS_COUNT:-1}"
+RUNS_COUNT="${RUNS_COUNT:-20}"
+
+SOURCE="./benchmarks/native/main.cpp"
+BUILD_DIR="./benchmarks/native/pgo"
+PROFILE_DIR="${BUILD_DIR}/profile"
+PROFDATA="${BUILD_DIR}/konlatt.profdata"
+BASELINE_BINARY="${BUILD_DIR}/main_baseline"
+PGO_BINARY="${BUILD_DIR}/main_pgo"
+REPORT="./benchmarks/native/pgo_report.md"
+
+OPTIMIZE="-O3"
+COMMON_FLAGS="-std=gnu++17 ${OPTIMIZE} -pthread"
+
+if [ -z "${DATASETS}" ]; then
+    DATASETS=(./datasets/mushroomep.cxt ./datasets/nom10crx.cxt ./datasets/nom5crx.cxt ./datasets/nom5shuttle.cxt ./datasets/ord5shuttle.cxt ./datasets/sorted.cxt)
+else
+    read -r -a DATASETS <<< "${DATASETS}"
+fi
+
+if [ -z "${TRAINING_DATASETS}" ]; then
+    TRAINING_DATASETS=(./datasets/*.cxt)
+else
+    read -r -a TRAINING_DATASETS <<< "${TRAINING_DATASETS}"
+fi
+
+if [[ "${COMPILER}" == *clang* ]]; then
+    GENERATE_FLAGS="-fprofile-instr-generate=${PROFILE_DIR}/%p.profraw"
+    USE_FLAGS="-fprofile-instr-use=${PROFDATA}"
+else
+    # The profile is looked up by the name of the output binary, so both PGO builds have to use the same output path
+    # -fprofile-correction: the counters of the multithreaded code may be slightly inconsistent
+    GENERATE_FLAGS="-fprofile-generate=${PROFILE_DIR}"
+    USE_FLAGS="-fprofile-use=${PROFILE_DIR} -fprofile-correction"
+fi
+
+# Prints the average time, the standard deviation and the concepts count of a benchmark run, separated by spaces
+run_benchmark() {
+    local binary="$1"
+    local dataset="$2"
+    local runs_count="$3"
+    local output
+
+    output=$("${binary}" "${dataset}" "${runs_count}" 2>&1)
+
+    local average=$(echo "${output}" | sed -n 's/^Average time: \(.*\)ms$/\1/p')
+    local deviation=$(echo "${output}" | sed -n 's/^Standard deviation: \(.*\)ms$/\1/p')
+    local concepts=$(echo "${output}" | sed -n 's/^Concepts: \(.*\)$/\1/p')
+
+    echo "${average} ${deviation} ${concepts}"
+}
+
+echo "============================================="
+echo "Building the baseline and instrumented benchmarks with ${COMPILER}"
+echo "============================================="
+
+rm -rf "${BUILD_DIR}"
+mkdir -p "${PROFILE_DIR}"
+
+${COMPILER} ${COMMON_FLAGS} -o "${BASELINE_BINARY}" "${SOURCE}"
+${COMPILER} ${COMMON_FLAGS} ${GENERATE_FLAGS} -o "${PGO_BINARY}" "${SOURCE}"
+
+echo "============================================="
+echo "Collecting the profile"
+echo "============================================="
+
+for dataset in "${TRAINING_DATASETS[@]}"; do
+    echo "${dataset}"
+    # Malformed datasets are rejected by the parser and do not contribute to the profile
+    "${PGO_BINARY}" "${dataset}" "${TRAINING_RUNS_COUNT}" > /dev/null 2>&1 || echo "Skipped ${dataset}"
+done
+
+if [[ "${COMPILER}" == *clang* ]]; then
+    llvm-profdata merge -output="${PROFDATA}" "${PROFILE_DIR}"/*.profraw
+fi
+
+echo "============================================="
+echo "Building the optimized benchmark"
+echo "============================================="
+
+${COMPILER} ${COMMON_FLAGS} ${USE_FLAGS} -o "${PGO_BINARY}" "${SOURCE}"
+
+echo "============================================="
+echo "Comparing the builds"
+echo "============================================="
+
+{
+    echo "# PGO Report"
+    echo ""
+    echo "\`InClose\` ${RUNS_COUNT}x in a row ⇒ average in milliseconds, the profile was collected by ${TRAINING_RUNS_COUNT} run(s) over all the datasets"
+    echo ""
+    echo "- $(${COMPILER} --version | head -n 1)"
+    echo "- $(uname -s -m)"
+    echo ""
+    echo "| Dataset | Concepts | Baseline | Std. dev. | PGO | Std. dev. | Speedup |"
+    echo "| ------- | -------: | -------: | --------: | --: | --------: | ------: |"
+} > "${REPORT}"
+
+for dataset in "${DATASETS[@]}"; do
+    read -r baseline_average baseline_deviation concepts <<< "$(run_benchmark "${BASELINE_BINARY}" "${dataset}" "${RUNS_COUNT}")"
+    read -r pgo_average pgo_deviation _ <<< "$(run_benchmark "${PGO_BINARY}" "${dataset}" "${RUNS_COUNT}")"
+
+    speedup=$(awk -v baseline="${baseline_average}" -v pgo="${pgo_average}" 'BEGIN { if (pgo > 0) printf "%.2fx", baseline / pgo; else print "–" }')
+    name=$(basename "${dataset}" .cxt)
+
+    printf "| %s | %s | %.3f | %.3f | %.3f | %.3f | %s |\n" \
+        "${name}" "${concepts}" "${baseline_average}" "${baseline_deviation}" "${pgo_average}" "${pgo_deviation}" "${speedup}" >> "${REPORT}"
+    echo "${name}: ${baseline_average} ms -> ${pgo_average} ms (${speedup})"
+done
+
+echo "============================================="
+echo "Report written to ${REPORT}"
+echo "============================================="
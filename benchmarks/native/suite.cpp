@@ -0,0 +1,755 @@
+// Benchmark suite of the native kernels over all the datasets
+// The results are written as JSON, so that two runs can be compared by ./benchmarks/native/compare.ts
+
+// Eigen has to be downloaded to ./libs first (see emscripten.build.sh)
+
+// GCC Unix:
+// g++ -std=c++17 -O3 -pthread -I libs/ ./benchmarks/native/suite.cpp -o ./benchmarks/native/suite_gcc
+
+// Clang macOS:
+// clang++ -std=gnu++17 -O3 -pthread -I libs/ ./benchmarks/native/suite.cpp -o ./benchmarks/native/suite_clang
+
+// Usage:
+// ./benchmarks/native/suite_gcc [options]
+//
+// Options:
+// --datasets <directory>           directory with the .cxt files (default: ./datasets)
+// --filter <text>                  only the datasets whose file name contains the text
+// --benchmarks <name,name,...>     only the listed benchmarks (default: all)
+// --warmup <number>                unmeasured runs before the measurement (default: 1)
+// --runs <number>                  measured runs (default: 10)
+// --time-budget <milliseconds>     measurement of a benchmark stops after this time if at least one run was measured (default: 10000)
+// --max-layout-concepts <number>   force-directed layouts are skipped for larger lattices (default: 1000)
+// --output <file>                  JSON output file (default: standard output)
+// --trace <directory>              Chrome trace of the last run of each benchmark is written there, the suite has to be compiled with -DKONLATT_TRACE
+//
+// Synthetic contexts (replace the datasets when any of the options is used):
+// --synthetic-objects <number,...>         objects counts (default: 100)
+// --synthetic-attributes <number,...>      attributes counts (default: 50)
+// --synthetic-density <number,...>         probabilities of an incidence (default: 0.1)
+// --synthetic-correlation <number,...>     probabilities of copying the previous attribute (default: 0)
+// --synthetic-planted <number,...>         counts of planted concepts, each covers a tenth of the objects and attributes (default: 0)
+// --synthetic-seed <number>                seed of the generator (default: 42)
+// --synthetic-save <directory>             the generated contexts are also written there as .cxt files
+//
+// Every combination of the listed values is benchmarked, so a list of one parameter produces a scaling curve, e.g.:
+// ./benchmarks/native/suite_gcc --synthetic-objects 1000,2000,4000,8000 --synthetic-density 0.2 --output objects.json
+
+#include "../../src/cpp/types/FormalConcept.h"
+#include "../../src/cpp/types/Implication.h"
+#include "../../src/cpp/types/FormalContext.h"
+#include "../../src/cpp/types/TimedResult.h"
+#include "../../src/cpp/types/IterativeTimedResult.h"
+#include "../../src/cpp/types/ConvergenceCriteria.h"
+#include "../../src/cpp/syntheticContext.h"
+#include "../../src/cpp/types/MemoryUsage.h"
+#include "../../src/cpp/memory.h"
+
+#include <stdio.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <stdexcept>
+#include <filesystem>
+#include <functional>
+
+#include "../../src/cpp/utils.cpp"
+#include "../../src/cpp/trace.cpp"
+#include "../../src/cpp/memory.cpp"
+#include "../../src/cpp/mappedFile.cpp"
+#include "../../src/cpp/parallel.cpp"
+#include "../../src/cpp/burmeister.cpp"
+#include "../../src/cpp/compressedExtent.cpp"
+#include "../../src/cpp/inClose.cpp"
+#include "../../src/cpp/conceptsCover.cpp"
+#include "../../src/cpp/implicationBasis.cpp"
+#include "../../src/cpp/layout/utils.cpp"
+#include "../../src/cpp/layout/convergence.cpp"
+#include "../../src/cpp/layout/warmStart.cpp"
+#include "../../src/cpp/layout/layers.cpp"
+#include "../../src/cpp/layout/coffmanGrahamLayers.cpp"
+#include "../../src/cpp/layout/networkSimplexLayers.cpp"
+#include "../../src/cpp/layout/layered/crossCount.cpp"
+#include "../../src/cpp/layout/layered/dummies.cpp"
+#include "../../src/cpp/layout/layered/simplePlacement.cpp"
+#include "../../src/cpp/layout/layered/bkPlacement.cpp"
+#include "../../src/cpp/layout/layered/ellipsePlacement.cpp"
+#include "../../src/cpp/layout/layered/layeredLayout.cpp"
+#include "../../src/cpp/layout/freeseLayout.cpp"
+#include "../../src/cpp/layout/reDrawLayout.cpp"
+#include "../../src/cpp/syntheticContext.cpp"
+
+#define SUITE_FORMAT_VERSION 1
+#define CROSSINGS_TIME_BUDGET 1000
+#define REDRAW_SEED 42
+#define REDRAW_TARGET_DIMENSION 3
+
+const std::vector<std::string> BENCHMARK_NAMES = {
+    "parseBurmeister",
+    "parseBurmeisterParallel",
+    "inClose",
+    "inCloseCompressed",
+    "conceptsCover",
+    "duquenneGuiguesBasis",
+    "crossCount",
+    "bkPlacement",
+    "computeFreeseLayout",
+    "computeReDrawLayout",
+};
+
+struct SuiteOptions {
+    std::string datasetsDirectory = "./datasets";
+    std::string filter;
+    std::vector<std::string> benchmarks = BENCHMARK_NAMES;
+    int warmupRuns = 1;
+    int runs = 10;
+    long long timeBudget = 10000;
+    int maxLayoutConcepts = 1000;
+    std::string outputFile;
+    std::string traceDirectory;
+
+    bool synthetic = false;
+    std::vector<int> syntheticObjectsCounts = { 100 };
+    std::vector<int> syntheticAttributesCounts = { 50 };
+    std::vector<double> syntheticDensities = { 0.1 };
+    std::vector<double> syntheticCorrelations = { 0.0 };
+    std::vector<int> syntheticPlantedConceptsCounts = { 0 };
+    unsigned int syntheticSeed = 42;
+    std::string syntheticSaveDirectory;
+};
+
+struct Statistics {
+    double mean;
+    double median;
+    double min;
+    double max;
+    double stdDeviation;
+};
+
+struct BenchmarkResult {
+    std::string dataset;
+    std::string benchmark;
+    int objectsCount;
+    int attributesCount;
+    int conceptsCount;
+    int runs;
+    Statistics statistics;
+    /// @brief Heap usage of the last measured run.
+    MemoryUsage memory;
+};
+
+std::string readFileToString(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return "";
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+Statistics generateStats(std::vector<double> times) {
+    std::sort(times.begin(), times.end());
+
+    double timesSum = std::accumulate(times.begin(), times.end(), 0.0);
+    double mean = timesSum / times.size();
+
+    double deviationsSum = 0.0;
+    for (double current : times) {
+        deviationsSum += std::pow(current - mean, 2);
+    }
+
+    size_t middle = times.size() / 2;
+    double median = times.size() % 2 == 0 ?
+        (times[middle - 1] + times[middle]) / 2 :
+        times[middle];
+
+    return { mean, median, times.front(), times.back(), std::sqrt(deviationsSum / times.size()) };
+}
+
+/// @brief Measures the given function by a steady clock.
+/// @return Elapsed time in nanoseconds.
+template <typename Function>
+long long measureNanoseconds(Function&& function) {
+    auto startTime = std::chrono::steady_clock::now();
+    function();
+    auto endTime = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+}
+
+/// @brief Runs a benchmark repeatedly and collects statistics of the measured times in nanoseconds.
+/// @param run Runs the benchmark once and returns the time of the measured part,
+/// so that the preparation of the inputs and the destruction of the outputs are not measured.
+/// @return Number of the measured runs.
+int runBenchmark(const SuiteOptions& options, const std::function<long long()>& run, Statistics& statistics, MemoryUsage& memory) {
+    for (int i = 0; i < options.warmupRuns; i++) {
+        run();
+    }
+
+    std::vector<double> times;
+    long long totalTime = 0;
+    long long timeBudget = options.timeBudget * 1000000;
+
+    for (int i = 0; i < options.runs; i++) {
+        // Only the last run stays in the trace
+        resetTrace();
+
+        MemoryTracker memoryTracker;
+        long long time = run();
+        memory = memoryTracker.finish();
+
+        times.push_back(time);
+        totalTime += time;
+
+        if (timeBudget > 0 && totalTime >= timeBudget) {
+            break;
+        }
+    }
+
+    statistics = generateStats(times);
+
+    return times.size();
+}
+
+bool isBenchmarkEnabled(const SuiteOptions& options, const std::string& name) {
+    return std::find(options.benchmarks.begin(), options.benchmarks.end(), name) != options.benchmarks.end();
+}
+
+void runDatasetBenchmarks(
+    const std::string& datasetName,
+    const std::string& fileContent,
+    const SuiteOptions& options,
+    std::vector<BenchmarkResult>& results
+) {
+    auto onProgress = [](double) {};
+    ConvergenceCriteria convergenceCriteria(0.001, 0.0001, 0);
+
+    FormalContext context = parseBurmeister(fileContent, false);
+    int objectsCount = context.getObjects().size();
+    int attributesCount = context.getAttributes().size();
+
+    // The outputs of the previous kernels are the inputs of the next ones
+    TimedResult<std::vector<FormalConcept>> conceptsResult;
+    inClose(
+        conceptsResult,
+        context.getContext(),
+        context.getCellSize(),
+        context.getCellsPerObject(),
+        objectsCount,
+        attributesCount);
+
+    int conceptsCount = conceptsResult.value.size();
+    std::vector<SimpleFormalConcept> concepts(conceptsCount);
+
+    for (int i = 0; i < conceptsCount; i++) {
+        concepts[i].setObjects(conceptsResult.value[i].getObjects());
+        concepts[i].setAttributes(conceptsResult.value[i].getAttributes());
+    }
+
+    conceptsResult.value.clear();
+    conceptsResult.value.shrink_to_fit();
+
+    TimedResult<std::vector<std::vector<int>>> coverResult;
+    conceptsCover(
+        coverResult,
+        concepts,
+        context.getContext(),
+        context.getCellSize(),
+        context.getCellsPerObject(),
+        objectsCount,
+        attributesCount);
+
+    std::vector<std::unordered_set<int>> subconceptsMapping(conceptsCount);
+    std::vector<std::unordered_set<int>> superconceptsMapping(conceptsCount);
+    int supremum = 0;
+    int infimum = 0;
+
+    for (int concept = 0; concept < conceptsCount; concept++) {
+        for (int superconcept : coverResult.value[concept]) {
+            superconceptsMapping[concept].insert(superconcept);
+            subconceptsMapping[superconcept].insert(concept);
+        }
+    }
+
+    for (int concept = 0; concept < conceptsCount; concept++) {
+        if (superconceptsMapping[concept].empty()) {
+            supremum = concept;
+        }
+        if (subconceptsMapping[concept].empty()) {
+            infimum = concept;
+        }
+    }
+
+    auto addResult = [&](const std::string& benchmark, const std::function<long long()>& run) {
+        if (!isBenchmarkEnabled(options, benchmark)) {
+            return;
+        }
+
+        BenchmarkResult result { datasetName, benchmark, objectsCount, attributesCount, conceptsCount, 0, {}, {} };
+        result.runs = runBenchmark(options, run, result.statistics, result.memory);
+        results.push_back(result);
+
+        if (!options.traceDirectory.empty()) {
+            auto filePath = std::filesystem::path(options.traceDirectory) / (datasetName + "_" + benchmark + ".json");
+            std::ofstream file(filePath);
+            file << exportTraceJson();
+        }
+
+        std::cerr << datasetName << " " << benchmark << ": "
+            << result.statistics.mean / 1000000 << " ms, peak " << result.memory.peakBytes / 1024 << " KiB (" << result.runs << " runs)" << std::endl;
+    };
+
+    addResult("parseBurmeister", [&]() {
+        FormalContext parsedContext;
+        return measureNanoseconds([&]() { parsedContext = parseBurmeisterView(fileContent); });
+    });
+
+    addResult("parseBurmeisterParallel", [&]() {
+        FormalContext parsedContext;
+        return measureNanoseconds([&]() { parsedContext = parseBurmeisterView(fileContent, true); });
+    });
+
+    addResult("inClose", [&]() {
+        TimedResult<std::vector<FormalConcept>> result;
+        return measureNanoseconds([&]() {
+            inClose(
+                result,
+                context.getContext(),
+                context.getCellSize(),
+                context.getCellsPerObject(),
+                objectsCount,
+                attributesCount);
+        });
+    });
+
+    addResult("inCloseCompressed", [&]() {
+        TimedResult<std::vector<CompressedFormalConcept>> result;
+        return measureNanoseconds([&]() {
+            inCloseCompressed(
+                result,
+                context.getContext(),
+                context.getCellSize(),
+                context.getCellsPerObject(),
+                objectsCount,
+                attributesCount);
+        });
+    });
+
+    addResult("conceptsCover", [&]() {
+        TimedResult<std::vector<std::vector<int>>> result;
+        return measureNanoseconds([&]() {
+            conceptsCover(
+                result,
+                concepts,
+                context.getContext(),
+                context.getCellSize(),
+                context.getCellsPerObject(),
+                objectsCount,
+                attributesCount);
+        });
+    });
+
+    addResult("duquenneGuiguesBasis", [&]() {
+        TimedResult<std::vector<Implication>> result;
+        return measureNanoseconds([&]() {
+            duquenneGuiguesBasis(
+                result,
+                context.getContext(),
+                context.getCellSize(),
+                context.getCellsPerObject(),
+                objectsCount,
+                attributesCount);
+        });
+    });
+
+    if (isBenchmarkEnabled(options, "crossCount") || isBenchmarkEnabled(options, "bkPlacement")) {
+        // Both kernels work on the layers with dummy nodes that are ordered by the crossing reduction
+        auto subconceptsMappingWithDummies = subconceptsMapping;
+        auto superconceptsMappingWithDummies = superconceptsMapping;
+        auto progress = ProgressData(ORDERED_LAYERS_PROGRESS_BLOCKS_COUNT, onProgress);
+        auto layersResult = assignNodesToLayers(supremum, subconceptsMappingWithDummies, superconceptsMappingWithDummies, "longestPath");
+        auto& [layersMapping, layers] = *layersResult;
+        auto orderedLayers = computeOrderedLayers(
+            conceptsCount,
+            subconceptsMappingWithDummies,
+            superconceptsMappingWithDummies,
+            layersMapping,
+            layers,
+            CROSSINGS_TIME_BUDGET,
+            0,
+            progress);
+
+        std::vector<int> horizontalPositions(subconceptsMappingWithDummies.size());
+
+        for (auto& layer : *orderedLayers) {
+            for (int i = 0; i < layer.size(); i++) {
+                horizontalPositions[layer[i]] = i;
+            }
+        }
+
+        addResult("crossCount", [&]() {
+            CrossCountDataStructures dataStructures;
+            return measureNanoseconds([&]() {
+                crossCount(*orderedLayers, horizontalPositions, subconceptsMappingWithDummies, dataStructures);
+            });
+        });
+
+        addResult("bkPlacement", [&]() {
+            std::vector<float> result(conceptsCount * COORDS_COUNT);
+            auto placementProgress = ProgressData(getPlacementProgressBlocksCount("bk"), onProgress);
+            return measureNanoseconds([&]() {
+                bkPlacement(
+                    result,
+                    *orderedLayers,
+                    subconceptsMappingWithDummies,
+                    superconceptsMappingWithDummies,
+                    conceptsCount,
+                    placementProgress);
+            });
+        });
+    }
+
+    if (conceptsCount > options.maxLayoutConcepts) {
+        std::cerr << datasetName << ": force-directed layouts skipped (" << conceptsCount << " concepts)" << std::endl;
+        return;
+    }
+
+    addResult("computeFreeseLayout", [&]() {
+        IterativeTimedResult<std::vector<float>> result;
+        return measureNanoseconds([&]() {
+            computeFreeseLayout(
+                result,
+                supremum,
+                infimum,
+                conceptsCount,
+                subconceptsMapping,
+                superconceptsMapping,
+                convergenceCriteria,
+                std::nullopt,
+                onProgress);
+        });
+    });
+
+    addResult("computeReDrawLayout", [&]() {
+        IterativeTimedResult<std::vector<float>> result;
+        return measureNanoseconds([&]() {
+            computeReDrawLayout(
+                result,
+                supremum,
+                infimum,
+                conceptsCount,
+                subconceptsMapping,
+                superconceptsMapping,
+                REDRAW_SEED,
+                REDRAW_TARGET_DIMENSION,
+                false,
+                convergenceCriteria,
+                std::nullopt,
+                onProgress);
+        });
+    });
+}
+
+std::string escapeJson(const std::string& value) {
+    std::string escaped;
+
+    for (char character : value) {
+        switch (character) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default: escaped += character;
+        }
+    }
+
+    return escaped;
+}
+
+std::string getCompilerName() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+void writeJson(std::ostream& stream, const SuiteOptions& options, const std::vector<BenchmarkResult>& results) {
+    stream << "{" << std::endl;
+    stream << "  \"version\": " << SUITE_FORMAT_VERSION << "," << std::endl;
+    stream << "  \"timestamp\": " << std::time(nullptr) << "," << std::endl;
+    stream << "  \"compiler\": \"" << escapeJson(getCompilerName()) << "\"," << std::endl;
+    stream << "  \"warmupRuns\": " << options.warmupRuns << "," << std::endl;
+    stream << "  \"runs\": " << options.runs << "," << std::endl;
+    stream << "  \"results\": [" << std::endl;
+
+    stream << std::fixed;
+    stream.precision(1);
+
+    for (int i = 0; i < results.size(); i++) {
+        auto& result = results[i];
+
+        stream << "    {"
+            << "\"dataset\": \"" << escapeJson(result.dataset) << "\", "
+            << "\"benchmark\": \"" << result.benchmark << "\", "
+            << "\"objects\": " << result.objectsCount << ", "
+            << "\"attributes\": " << result.attributesCount << ", "
+            << "\"concepts\": " << result.conceptsCount << ", "
+            << "\"runs\": " << result.runs << ", "
+            << "\"meanNs\": " << result.statistics.mean << ", "
+            << "\"medianNs\": " << result.statistics.median << ", "
+            << "\"minNs\": " << result.statistics.min << ", "
+            << "\"maxNs\": " << result.statistics.max << ", "
+            << "\"stdDeviationNs\": " << result.statistics.stdDeviation << ", "
+            << "\"allocatedBytes\": " << result.memory.allocatedBytes << ", "
+            << "\"peakBytes\": " << result.memory.peakBytes << ", "
+            << "\"allocationsCount\": " << result.memory.allocationsCount
+            << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    stream << "  ]" << std::endl;
+    stream << "}" << std::endl;
+}
+
+std::vector<std::string> splitList(const std::string& value) {
+    std::vector<std::string> items;
+    std::stringstream stream(value);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+template <typename T>
+std::vector<T> parseNumbers(const std::string& value) {
+    std::vector<T> numbers;
+
+    for (auto& item : splitList(value)) {
+        numbers.push_back((T)std::stod(item));
+    }
+
+    return numbers;
+}
+
+std::string formatParameter(double value) {
+    std::stringstream stream;
+    stream << value;
+    return stream.str();
+}
+
+/// @brief Generates a context for each combination of the synthetic parameters and benchmarks it.
+bool runSyntheticBenchmarks(const SuiteOptions& options, std::vector<BenchmarkResult>& results) {
+    for (int objectsCount : options.syntheticObjectsCounts) {
+        for (int attributesCount : options.syntheticAttributesCounts) {
+            for (double density : options.syntheticDensities) {
+                for (double correlation : options.syntheticCorrelations) {
+                    for (int plantedConceptsCount : options.syntheticPlantedConceptsCounts) {
+                        SyntheticContextOptions contextOptions;
+                        contextOptions.objectsCount = objectsCount;
+                        contextOptions.attributesCount = attributesCount;
+                        contextOptions.density = density;
+                        contextOptions.correlation = correlation;
+                        contextOptions.plantedConceptsCount = plantedConceptsCount;
+                        contextOptions.plantedConceptObjectsCount = std::max(objectsCount / 10, 1);
+                        contextOptions.plantedConceptAttributesCount = std::max(attributesCount / 10, 1);
+                        contextOptions.seed = options.syntheticSeed;
+
+                        std::string name = "synthetic_o" + std::to_string(objectsCount) +
+                            "_a" + std::to_string(attributesCount) +
+                            "_d" + formatParameter(density) +
+                            "_c" + formatParameter(correlation) +
+                            "_p" + std::to_string(plantedConceptsCount);
+
+                        FormalContext context = generateSyntheticContext(contextOptions);
+                        // The parser is benchmarked as well, so the context goes through the .cxt format
+                        std::string fileContent = writeBurmeister(context, name);
+
+                        if (!options.syntheticSaveDirectory.empty()) {
+                            auto filePath = std::filesystem::path(options.syntheticSaveDirectory) / (name + ".cxt");
+                            std::ofstream file(filePath, std::ios::binary);
+
+                            if (!file.is_open()) {
+                                std::cerr << "Error writing file " << filePath << std::endl;
+                                return false;
+                            }
+
+                            file << fileContent;
+                        }
+
+                        runDatasetBenchmarks(name, fileContent, options, results);
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+bool parseOptions(int argc, char* argv[], SuiteOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value of option " << argument << std::endl;
+            return false;
+        }
+
+        std::string value = argv[++i];
+
+        if (argument == "--datasets") {
+            options.datasetsDirectory = value;
+        }
+        else if (argument == "--filter") {
+            options.filter = value;
+        }
+        else if (argument == "--benchmarks") {
+            options.benchmarks = splitList(value);
+
+            for (auto& benchmark : options.benchmarks) {
+                if (std::find(BENCHMARK_NAMES.begin(), BENCHMARK_NAMES.end(), benchmark) == BENCHMARK_NAMES.end()) {
+                    std::cerr << "Unknown benchmark " << benchmark << std::endl;
+                    return false;
+                }
+            }
+        }
+        else if (argument == "--warmup") {
+            options.warmupRuns = std::stoi(value);
+        }
+        else if (argument == "--runs") {
+            options.runs = std::max(std::stoi(value), 1);
+        }
+        else if (argument == "--time-budget") {
+            options.timeBudget = std::stoll(value);
+        }
+        else if (argument == "--max-layout-concepts") {
+            options.maxLayoutConcepts = std::stoi(value);
+        }
+        else if (argument == "--output") {
+            options.outputFile = value;
+        }
+        else if (argument == "--trace") {
+            if (!isTraceEnabled()) {
+                std::cerr << "The suite has to be compiled with -DKONLATT_TRACE to record a trace" << std::endl;
+                return false;
+            }
+
+            options.traceDirectory = value;
+        }
+        else if (argument.rfind("--synthetic-", 0) == 0) {
+            options.synthetic = true;
+
+            if (argument == "--synthetic-objects") {
+                options.syntheticObjectsCounts = parseNumbers<int>(value);
+            }
+            else if (argument == "--synthetic-attributes") {
+                options.syntheticAttributesCounts = parseNumbers<int>(value);
+            }
+            else if (argument == "--synthetic-density") {
+                options.syntheticDensities = parseNumbers<double>(value);
+            }
+            else if (argument == "--synthetic-correlation") {
+                options.syntheticCorrelations = parseNumbers<double>(value);
+            }
+            else if (argument == "--synthetic-planted") {
+                options.syntheticPlantedConceptsCounts = parseNumbers<int>(value);
+            }
+            else if (argument == "--synthetic-seed") {
+                options.syntheticSeed = std::stoul(value);
+            }
+            else if (argument == "--synthetic-save") {
+                options.syntheticSaveDirectory = value;
+            }
+            else {
+                std::cerr << "Unknown option " << argument << std::endl;
+                return false;
+            }
+        }
+        else {
+            std::cerr << "Unknown option " << argument << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    SuiteOptions options;
+
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "Usage: " << argv[0] << " [--datasets <directory>] [--filter <text>] [--benchmarks <name,...>]"
+            << " [--warmup <number>] [--runs <number>] [--time-budget <milliseconds>]"
+            << " [--max-layout-concepts <number>] [--output <file>] [--trace <directory>]"
+            << " [--synthetic-objects <number,...>] [--synthetic-attributes <number,...>] [--synthetic-density <number,...>]"
+            << " [--synthetic-correlation <number,...>] [--synthetic-planted <number,...>] [--synthetic-seed <number>]"
+            << " [--synthetic-save <directory>]" << std::endl;
+        return 1;
+    }
+
+    std::vector<BenchmarkResult> results;
+    std::vector<std::filesystem::path> datasetPaths;
+
+    if (options.synthetic) {
+        if (!runSyntheticBenchmarks(options, results)) {
+            return 1;
+        }
+    }
+    else {
+        for (auto& entry : std::filesystem::directory_iterator(options.datasetsDirectory)) {
+            auto fileName = entry.path().filename().string();
+
+            if (entry.path().extension() == ".cxt" && fileName.find(options.filter) != std::string::npos) {
+                datasetPaths.push_back(entry.path());
+            }
+        }
+
+        std::sort(datasetPaths.begin(), datasetPaths.end());
+    }
+
+    for (auto& datasetPath : datasetPaths) {
+        std::string fileContent = readFileToString(datasetPath.string());
+
+        if (fileContent.empty()) {
+            std::cerr << "Error reading file " << datasetPath << std::endl;
+            return 1;
+        }
+
+        try {
+            runDatasetBenchmarks(datasetPath.stem().string(), fileContent, options, results);
+        }
+        catch (const std::invalid_argument& exception) {
+            // Malformed datasets are skipped, so that they do not stop the whole suite
+            std::cerr << "Skipping " << datasetPath << ": " << exception.what() << std::endl;
+        }
+    }
+
+    if (options.outputFile.empty()) {
+        writeJson(std::cout, options, results);
+    }
+    else {
+        std::ofstream file(options.outputFile);
+        writeJson(file, options, results);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -57,6 +57,14 @@ export LDFLAGS="${OPTIMIZE}"
 export CFLAGS="${OPTIMIZE}"
 export CXXFLAGS="${OPTIMIZE}"
 
+# Instrumentation of the hot paths, the trace is exported by exportTraceJson()
+TRACE_FLAGS=""
+
+if [ "${KONLATT_TRACE}" = "1" ]; then
+    echo "Compiling with the instrumentation"
+    TRACE_FLAGS="-DKONLATT_TRACE"
+fi
+
 echo "============================================="
 echo "Compiling wasm bindings"
 echo "============================================="
@@ -68,6 +76,7 @@ echo "============================================="
     src/cpp/main.cpp \
     -o ./index.js \
     ${OPTIMIZE} \
+    ${TRACE_FLAGS} \
     -s ALLOW_MEMORY_GROWTH=1 \
     -s MALLOC=emmalloc \
     -s MODULARIZE=1 \
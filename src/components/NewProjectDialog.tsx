@@ -25,6 +25,7 @@ const FILE_TYPES: Array<{ key: ImportFormat, label: string, idealExtension: stri
     { key: "json", label: "Konlatt JSON (.json)", idealExtension: ".json" },
     { key: "xml", label: "Konlatt XML (.xml)", idealExtension: ".xml" },
     { key: "csv", label: "CSV (.csv)", idealExtension: ".csv" },
+    { key: "project", label: "Konlatt project (.konlatt)", idealExtension: ".konlatt" },
 ];
 
 export default function NewProjectDialog(props: {
@@ -69,7 +70,7 @@ export default function NewProjectDialog(props: {
         setDisabled(true);
 
         triggerInitialization(
-            await selectedFile.text(),
+            selectedFileFormat === "project" ? await selectedFile.arrayBuffer() : await selectedFile.text(),
             selectedFileFormat,
             selectedCsvSeparator,
             withoutExtension(selectedFile.name),
@@ -13,6 +13,8 @@ import Button from "../../inputs/Button";
 import { LuRefreshCcw } from "react-icons/lu";
 import AngleSlider from "./AngleSlider";
 import { LayeredLayoutPlacement } from "../../../types/diagram/LayeredLayoutPlacement";
+import { LayeredLayoutLayering } from "../../../types/diagram/LayeredLayoutLayering";
+import { MultilevelLayoutEngine } from "../../../types/diagram/MultilevelLayoutEngine";
 import InputLabel from "../../inputs/InputLabel";
 import ConfigSection from "../../layouts/ConfigSection";
 import LabelsSelectionButton from "./LabelsSelectionButton";
@@ -145,12 +147,16 @@ function NodesLinksSection() {
 function LayoutSection() {
     const layoutMethod = useDiagramStore((state) => state.layoutMethod);
     const placementLayered = useDiagramStore((state) => state.placementLayered);
+    const layeringLayered = useDiagramStore((state) => state.layeringLayered);
     const parallelizeReDraw = useDiagramStore((state) => state.parallelizeReDraw);
     const targetDimensionReDraw = useDiagramStore((state) => state.targetDimensionReDraw);
+    const engineMultilevel = useDiagramStore((state) => state.engineMultilevel);
     const setLayoutMethod = useDiagramStore((state) => state.setLayoutMethod);
     const setPlacementLayered = useDiagramStore((state) => state.setPlacementLayered);
+    const setLayeringLayered = useDiagramStore((state) => state.setLayeringLayered);
     const setParallelizeReDraw = useDiagramStore((state) => state.setParallelizeReDraw);
     const setTargetDimensionReDraw = useDiagramStore((state) => state.setTargetDimensionReDraw);
+    const setEngineMultilevel = useDiagramStore((state) => state.setEngineMultilevel);
 
     return (
         <ConfigSection
@@ -164,11 +170,27 @@ function LayoutSection() {
                         { key: "layered", label: "Layered" },
                         { key: "freese", label: "Freese" },
                         { key: "redraw", label: "ReDraw" },
+                        { key: "multilevel", label: "Multilevel" },
                     ]}
                     selectedKey={layoutMethod}
                     onKeySelectionChange={setLayoutMethod} />
             </div>
 
+            {layoutMethod === "layered" &&
+                <div>
+                    <InputLabel>Layer assignment</InputLabel>
+
+                    <ComboBox<LayeredLayoutLayering>
+                        id="diagram-layout-layered-layering"
+                        items={[
+                            { key: "longestPath", label: "Longest path" },
+                            { key: "coffmanGraham", label: "Coffman-Graham" },
+                            { key: "networkSimplex", label: "Network simplex" },
+                        ]}
+                        selectedKey={layeringLayered}
+                        onKeySelectionChange={setLayeringLayered} />
+                </div>}
+
             {layoutMethod === "layered" &&
                 <div>
                     <InputLabel>Horizontal placement</InputLabel>
@@ -184,7 +206,21 @@ function LayoutSection() {
                         onKeySelectionChange={setPlacementLayered} />
                 </div>}
 
-            {layoutMethod === "redraw" &&
+            {layoutMethod === "multilevel" &&
+                <div>
+                    <InputLabel>Coarse layout</InputLabel>
+
+                    <ComboBox<MultilevelLayoutEngine>
+                        id="diagram-layout-multilevel-engine"
+                        items={[
+                            { key: "freese", label: "Freese" },
+                            { key: "redraw", label: "ReDraw" },
+                        ]}
+                        selectedKey={engineMultilevel}
+                        onKeySelectionChange={setEngineMultilevel} />
+                </div>}
+
+            {(layoutMethod === "redraw" || (layoutMethod === "multilevel" && engineMultilevel === "redraw")) &&
                 <>
                     <SeedReDrawInput
                         id="redraw-seed" />
@@ -6,6 +6,7 @@ import InputLabel from "../inputs/InputLabel";
 import createDownloadButtonsComponent from "./createDownloadButtonsComponent";
 import createTextResultPreviewerComponent from "./createTextResultPreviewerComponent";
 import ExportButton from "./ExportButton";
+import ProjectDownloadButtons from "./ProjectDownloadButtons";
 import { ExportButtonProps } from "./types/ExportButtonProps";
 import { ExportItem } from "./types/ExportItem";
 
@@ -37,6 +38,12 @@ const ITEMS: Array<ExportItem<ContextExportFormat>> = [
         buttons: createDownloadButtonsComponent(useExportContextStore, "exported-context.csv", "\n"),
         options: () => <CsvOptions />,
     },
+    {
+        key: "project",
+        label: "Konlatt project",
+        content: ProjectDescription,
+        buttons: ProjectDownloadButtons,
+    },
 ];
 
 export default function ExportContextButton(props: ExportButtonProps) {
@@ -71,4 +78,14 @@ function CsvOptions() {
                 onCsvSeparatorChange={setCsvSeparator} />
         </div>
     );
+}
+
+function ProjectDescription() {
+    return (
+        <p
+            className="p-4 text-sm text-on-surface-muted">
+            The project file contains the context together with the computed concepts, lattice and diagram layout,
+            so that it can be opened without computing them again.
+        </p>
+    );
 }
\ No newline at end of file
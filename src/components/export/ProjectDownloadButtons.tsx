@@ -0,0 +1,46 @@
+import { LuDownload } from "react-icons/lu";
+import Button from "../inputs/Button";
+import useDataStructuresStore from "../../stores/useDataStructuresStore";
+import useDiagramStore from "../../stores/diagram/useDiagramStore";
+import { getProjectLayoutKey, PROJECT_FILE_EXTENSION, writeProjectFile } from "../../services/projectFile";
+import { downloadBlob } from "../../utils/export";
+
+export default function ProjectDownloadButtons() {
+    const context = useDataStructuresStore((state) => state.context);
+
+    function onDownloadClick() {
+        const { concepts, lattice } = useDataStructuresStore.getState();
+        const diagramState = useDiagramStore.getState();
+
+        if (!context) {
+            return;
+        }
+
+        // Only a finished layout of the whole lattice can be reopened
+        const layout = lattice && concepts && diagramState.currentLayoutJobId === null && diagramState.layout?.length === concepts.length ?
+            diagramState.layout :
+            null;
+        const buffer = writeProjectFile(
+            context,
+            concepts ?? undefined,
+            concepts && lattice ? lattice : undefined,
+            layout ? [{ key: getProjectLayoutKey(diagramState), layout }] : undefined);
+
+        downloadBlob(new Blob([buffer], { type: "application/octet-stream" }), `exported-project${PROJECT_FILE_EXTENSION}`);
+    }
+
+    return (
+        <div
+            className="px-4 pb-4">
+            <Button
+                variant="primary"
+                size="lg"
+                className="w-full justify-center"
+                disabled={!context}
+                onClick={onDownloadClick}>
+                <LuDownload />
+                Download
+            </Button>
+        </div>
+    );
+}
\ No newline at end of file
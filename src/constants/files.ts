@@ -1 +1 @@
-export const FILE_INPUT_ACCEPT = ".csv, .cxt, application/json, application/xml";
\ No newline at end of file
+export const FILE_INPUT_ACCEPT = ".csv, .cxt, .konlatt, application/json, application/xml";
\ No newline at end of file
@@ -0,0 +1,17 @@
+import { ConvergenceCriteria } from "../types/diagram/ConvergenceCriteria";
+
+// Values less than or equal to zero disable the corresponding criterion
+export const DEFAULT_CONVERGENCE_CRITERIA: ConvergenceCriteria = {
+    maxDisplacement: 0.001,
+    energyDelta: 0.0001,
+    timeBudget: 0,
+};
+
+// Milliseconds spent by improving the order of nodes in layers, values less than or equal to zero disable the limit.
+// The limit is disabled by default, because an interrupted ordering depends on the speed and load of the device.
+export const DEFAULT_LAYERED_CROSSINGS_TIME_BUDGET = 0;
+
+// Additional crossing reductions of the layered layout that start from randomly shuffled layers.
+// They share the crossings time budget, but run concurrently only in builds with threads,
+// otherwise the barycentric ordering of each of them adds to the computation time.
+export const DEFAULT_LAYERED_RESTARTS_COUNT = 0;
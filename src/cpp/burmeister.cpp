@@ -1,95 +1,330 @@
 #include "types/FormalContext.h"
 #include "utils.h"
+#include "parallel.h"
+#include "burmeister.h"
+
+#ifndef __EMSCRIPTEN__
+#include "mappedFile.h"
+#endif
 
 #include <stdio.h>
-#include <iostream>
-#include <sstream>
-#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <cctype>
+#include <algorithm>
+#include <stdexcept>
 
-FormalContext parseBurmeister(std::string fileContent) {
-    // TODO: Produce exceptions when issues with the file format are encountered
-    FormalContext context;
-    std::stringstream fileContentStream(fileContent);
+// Number of characters of a row that are classified at once
+#define INCIDENCES_WORD_SIZE 8
+// Cross tables smaller than this are parsed on a single thread, the threads would not pay off
+#define PARALLEL_PARSING_MIN_BYTES (1 << 20)
+
+/// @brief Returns the line starting at the position and moves the position to the start of the next line.
+/// The line break (\n or \r\n) is not part of the line.
+std::string_view readBurmeisterLine(std::string_view content, size_t& position) {
+    if (position >= content.size()) {
+        return std::string_view();
+    }
+
+    size_t end = content.find('\n', position);
+
+    if (end == std::string_view::npos) {
+        end = content.size();
+    }
+
+    std::string_view line = content.substr(position, end - position);
+    position = end + 1;
+
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+
+    return line;
+}
+
+/// @brief Returns the value without the leading and trailing white space.
+std::string_view trimmedView(std::string_view value) {
+    size_t start = 0;
+    size_t end = value.size();
+
+    while (start < end && std::isspace((unsigned char)value[start])) {
+        start++;
+    }
+    while (end > start && std::isspace((unsigned char)value[end - 1])) {
+        end--;
+    }
+
+    return value.substr(start, end - start);
+}
+
+std::string trimmedString(std::string_view value) {
+    return std::string(trimmedView(value));
+}
+
+/**
+ * Classifies 8 characters of a row at once, without branching on the characters.
+ *
+ * @return Bits of the 'X' or 'x' characters in the lowest byte, the first character is the lowest bit.
+ * The second byte holds the bits of the '.' characters.
+ */
+inline unsigned int classifyIncidences(const char* characters) {
+    const uint64_t lowBits = 0x7F7F7F7F7F7F7F7Full;
+    uint64_t word;
+    // The characters are loaded in the little-endian order of wasm and the common native targets
+    std::memcpy(&word, characters, sizeof(word));
+
+    // Upper case letters differ from lower case ones only by the 0x20 bit, which '.' has set already
+    uint64_t crosses = (word | 0x2020202020202020ull) ^ 0x7878787878787878ull;
+    uint64_t dots = word ^ 0x2E2E2E2E2E2E2E2Eull;
+
+    // 0x80 is set in each byte that is zero
+    crosses = ~(((crosses & lowBits) + lowBits) | crosses | lowBits);
+    dots = ~(((dots & lowBits) + lowBits) | dots | lowBits);
 
-    std::string bLine;
-    std::getline(fileContentStream, bLine);
+    // Gathers the highest bits of the bytes into the highest byte of the product
+    const uint64_t gather = 0x0102040810204080ull;
+    unsigned int crossBits = (unsigned int)(((crosses >> 7) * gather) >> 56);
+    unsigned int dotBits = (unsigned int)(((dots >> 7) * gather) >> 56);
 
-    std::string nameLine;
-    std::getline(fileContentStream, nameLine);
+    return crossBits | (dotBits << 8);
+}
 
-    std::string objectsCountLine;
-    std::getline(fileContentStream, objectsCountLine);
+/**
+ * Parses a row of the cross table, characters after the first attributesCount ones are ignored.
+ * @return false if the row is shorter than the number of attributes or contains other characters than '.', 'x' and 'X'.
+ */
+bool parseIncidences(std::string_view line, unsigned int* row, int cellSize, int attributesCount) {
+    line = trimmedView(line);
 
-    std::string attributesCountLine;
-    std::getline(fileContentStream, attributesCountLine);
+    if (line.size() < (size_t)attributesCount) {
+        return false;
+    }
+
+    bool valid = true;
+    int attribute = 0;
+
+    // The cell size is a multiple of the word size, so the bits of a word never span two cells
+    for (; attribute + INCIDENCES_WORD_SIZE <= attributesCount; attribute += INCIDENCES_WORD_SIZE) {
+        unsigned int bits = classifyIncidences(line.data() + attribute);
+        unsigned int crossBits = bits & 0xFF;
+
+        valid &= ((crossBits | (bits >> 8)) == 0xFF);
+        row[attribute / cellSize] |= crossBits << (attribute % cellSize);
+    }
+
+    for (; attribute < attributesCount; attribute++) {
+        char character = line[attribute];
+        bool cross = character == 'x' || character == 'X';
+
+        valid &= cross || character == '.';
+        row[attribute / cellSize] |= (unsigned int)cross << (attribute % cellSize);
+    }
+
+    return valid;
+}
+
+/**
+ * Parses the rows of the cross table one after another.
+ * @return false if a row is missing or invalid.
+ */
+bool parseIncidencesSequentially(
+    std::string_view fileContent,
+    size_t position,
+    unsigned int* contextMatrix,
+    int objectsCount,
+    int attributesCount,
+    int cellSize,
+    int cellsPerObject
+) {
+    for (int i = 0; i < objectsCount; i++) {
+        if (position >= fileContent.size()) {
+            return false;
+        }
+
+        std::string_view line = readBurmeisterLine(fileContent, position);
+
+        if (!parseIncidences(line, contextMatrix + (i * cellsPerObject), cellSize, attributesCount)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Splits the cross table into chunks on line boundaries and parses the chunks on multiple threads, if they are available.
+ * Line breaks of each chunk are counted first, so that every thread knows the first row of its chunk
+ * and the threads fill disjoint rows of the matrix.
+ * @return false if a row is missing or invalid.
+ */
+bool parseIncidencesInChunks(
+    std::string_view fileContent,
+    size_t position,
+    unsigned int* contextMatrix,
+    int objectsCount,
+    int attributesCount,
+    int cellSize,
+    int cellsPerObject,
+    int chunksCount
+) {
+    size_t incidencesSize = fileContent.size() - std::min(position, fileContent.size());
 
-    std::string emptyLine;
-    std::getline(fileContentStream, emptyLine);
+    // Each chunk starts right after a line break, the last one ends at the end of the content
+    std::vector<size_t> chunkStarts(chunksCount + 1, fileContent.size());
+    chunkStarts[0] = std::min(position, fileContent.size());
+
+    for (int chunk = 1; chunk < chunksCount; chunk++) {
+        size_t start = std::max(chunkStarts[0] + (incidencesSize / chunksCount) * chunk, chunkStarts[chunk - 1]);
+        size_t lineBreak = fileContent.find('\n', start);
+        chunkStarts[chunk] = lineBreak == std::string_view::npos ? fileContent.size() : lineBreak + 1;
+    }
 
-    int objectsCount = stoi(objectsCountLine);
-    int attributesCount = stoi(attributesCountLine);
+    std::vector<int> firstRows(chunksCount + 1, 0);
+
+    runInParallel(chunksCount, [&](int chunk) {
+        const char* begin = fileContent.data() + chunkStarts[chunk];
+        const char* end = fileContent.data() + chunkStarts[chunk + 1];
+        firstRows[chunk + 1] = (int)std::count(begin, end, '\n');
+    });
+
+    for (int chunk = 0; chunk < chunksCount; chunk++) {
+        firstRows[chunk + 1] += firstRows[chunk];
+    }
+
+    // The rows are checked for each chunk separately, all of them have to be valid and none may be missing
+    std::vector<int> parsedRowsCounts(chunksCount, 0);
+
+    runInParallel(chunksCount, [&](int chunk) {
+        size_t linePosition = chunkStarts[chunk];
+        int row = firstRows[chunk];
+        // The last line of the content does not have to be terminated by a line break
+        int rowsEnd = chunkStarts[chunk + 1] == fileContent.size() ? objectsCount : std::min(firstRows[chunk + 1], objectsCount);
+
+        for (; row < rowsEnd && linePosition < chunkStarts[chunk + 1]; row++) {
+            std::string_view line = readBurmeisterLine(fileContent, linePosition);
+
+            if (!parseIncidences(line, contextMatrix + (row * cellsPerObject), cellSize, attributesCount)) {
+                // The rows of an invalid chunk are not counted, so the whole table is invalid
+                return;
+            }
+        }
+
+        parsedRowsCounts[chunk] = std::max(row - firstRows[chunk], 0);
+    });
+
+    int parsedRowsCount = 0;
+
+    for (int count : parsedRowsCounts) {
+        parsedRowsCount += count;
+    }
+
+    return parsedRowsCount == objectsCount;
+}
+
+/**
+ * @param chunksCount Number of chunks the cross table is split into.
+ * 1 parses the rows sequentially, 0 uses as many threads as pay off for the size of the cross table.
+ */
+FormalContext parseBurmeisterViewInChunks(std::string_view fileContent, int chunksCount) {
+    FormalContext context;
+    size_t position = 0;
+
+    // White space around the content is ignored, so that only the actual lines are required to be present
+    fileContent = trimmedView(fileContent);
+
+    // The B line and the name line
+    readBurmeisterLine(fileContent, position);
+    readBurmeisterLine(fileContent, position);
+    std::string_view objectsCountLine = readBurmeisterLine(fileContent, position);
+    std::string_view attributesCountLine = readBurmeisterLine(fileContent, position);
+    // The empty line
+    readBurmeisterLine(fileContent, position);
+
+    int objectsCount;
+    int attributesCount;
+
+    try {
+        objectsCount = stoi(std::string(objectsCountLine));
+        attributesCount = stoi(std::string(attributesCountLine));
+    }
+    catch (const std::logic_error&) {
+        // std::invalid_argument or std::out_of_range thrown by the number conversions
+        throw std::invalid_argument("Line: 2 or 3");
+    }
+
+    if (objectsCount < 0 || attributesCount < 0) {
+        throw std::invalid_argument("Line: 2 or 3");
+    }
 
     int cellSize = sizeof(unsigned int) * 8;
+    int cellsPerObject = (int)ceil(attributesCount / (double)cellSize);
 
     std::vector<std::string> atributes;
     std::vector<std::string> objects;
-    std::vector<unsigned int> contextMatrix;
 
+    objects.reserve(objectsCount);
+    atributes.reserve(attributesCount);
+
+    // Each name has to be followed by at least one more line
     for (int i = 0; i < objectsCount; i++) {
-        std::string line;
-        std::getline(fileContentStream, line);
-        trim(line);
+        objects.push_back(trimmedString(readBurmeisterLine(fileContent, position)));
 
-        objects.push_back(line);
+        if (position >= fileContent.size()) {
+            throw std::invalid_argument("Objects could not be parsed.");
+        }
     }
 
     for (int i = 0; i < attributesCount; i++) {
-        std::string line;
-        std::getline(fileContentStream, line);
-        trim(line);
+        atributes.push_back(trimmedString(readBurmeisterLine(fileContent, position)));
 
-        atributes.push_back(line);
+        if (position >= fileContent.size()) {
+            throw std::invalid_argument("Attributes could not be parsed.");
+        }
     }
 
-    for (int i = 0; i < objectsCount; i++) {
-        std::string line;
-        std::getline(fileContentStream, line);
+    std::vector<unsigned int> contextMatrix((size_t)objectsCount * cellsPerObject, 0u);
 
-        int offset = 0;
-        unsigned int value = 0u;
+    if (chunksCount == 0) {
+        size_t incidencesSize = fileContent.size() - std::min(position, fileContent.size());
+        chunksCount = getThreadsCount((int)std::min<size_t>(incidencesSize / PARALLEL_PARSING_MIN_BYTES, objectsCount));
+    }
 
-        for (char & character : line) {
-            character = tolower(character);
+    bool valid = chunksCount <= 1 ?
+        parseIncidencesSequentially(fileContent, position, contextMatrix.data(), objectsCount, attributesCount, cellSize, cellsPerObject) :
+        parseIncidencesInChunks(fileContent, position, contextMatrix.data(), objectsCount, attributesCount, cellSize, cellsPerObject, chunksCount);
 
-            if (character == '.') {
-                offset++;
-            }
-            else if (character == 'x') {
-                value = value | (1u << offset);
-                offset++;
-            }
-            else {
-                // error
-            }
-
-            if (offset == cellSize) {
-                contextMatrix.push_back(value);
-                value = 0u;
-                offset = 0;
-            }
-        }
-        
-        contextMatrix.push_back(value);
+    if (!valid) {
+        throw std::invalid_argument("Context could not be parsed.");
     }
 
     context.setObjects(objects);
     context.setAttributes(atributes);
-    context.setCellsPerObject((int)ceil(atributes.size() / (double)cellSize));
+    context.setCellsPerObject(cellsPerObject);
     context.setCellSize(cellSize);
     context.setContext(contextMatrix);
 
     return context;
-}
\ No newline at end of file
+}
+
+FormalContext parseBurmeisterView(std::string_view fileContent, bool parallelize) {
+    return parseBurmeisterViewInChunks(fileContent, parallelize ? 0 : 1);
+}
+
+FormalContext parseBurmeister(const std::string& fileContent, bool parallelize) {
+    return parseBurmeisterView(fileContent, parallelize);
+}
+
+FormalContext parseBurmeisterInChunks(const std::string& fileContent, int chunksCount) {
+    return parseBurmeisterViewInChunks(fileContent, std::max(chunksCount, 1));
+}
+
+#ifndef __EMSCRIPTEN__
+FormalContext parseBurmeisterFile(const std::string& filePath, bool parallelize) {
+    MappedFile file(filePath);
+    return parseBurmeisterView(file.getContent(), parallelize);
+}
+#endif
\ No newline at end of file
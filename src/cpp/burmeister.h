@@ -1,9 +1,36 @@
 #ifndef BURMEISTER_H
 #define BURMEISTER_H
 
-#include "FormalContext.h"
+#include "types/FormalContext.h"
 #include <string>
+#include <string_view>
 
-FormalContext parseBurmeister(std::string fileContent);
+/**
+ * Parses the Burmeister (.cxt) format.
+ * @param parallelize Whether rows of large cross tables should be parsed on multiple threads.
+ * @throws std::invalid_argument if a name line or a row of the cross table is missing,
+ * a row is shorter than the number of attributes or contains other characters than '.', 'x' and 'X'.
+ */
+FormalContext parseBurmeister(const std::string& fileContent, bool parallelize);
+
+/**
+ * Parses the Burmeister (.cxt) format, the cross table is split into the given number of chunks regardless of its size.
+ * The chunks run on multiple threads only if they are available, so that the chunked parsing can be tested in any build.
+ */
+FormalContext parseBurmeisterInChunks(const std::string& fileContent, int chunksCount);
+
+/**
+ * Parses the Burmeister (.cxt) format without copying the content.
+ * The cross table is read 8 characters at a time and packed directly into the context matrix.
+ * When parallelized, the cross table is split on line boundaries and threads fill disjoint rows of the matrix.
+ */
+FormalContext parseBurmeisterView(std::string_view fileContent, bool parallelize = false);
+
+#ifndef __EMSCRIPTEN__
+/**
+ * Parses a Burmeister (.cxt) file that is mapped into memory.
+ */
+FormalContext parseBurmeisterFile(const std::string& filePath, bool parallelize = false);
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,538 @@
+// Native command-line tool computing diagram layouts of formal contexts in batches.
+// The same C++ code as in the WASM module is compiled natively, without the JavaScript bindings.
+
+// Eigen has to be downloaded to ./libs first (see emscripten.build.sh)
+
+// GCC Unix:
+// g++ -std=c++17 -O3 -pthread -I libs/ ./src/cpp/cli/main.cpp -o ./konlatt-cli
+
+// Clang macOS:
+// clang++ -std=gnu++17 -O3 -pthread -I libs/ ./src/cpp/cli/main.cpp -o ./konlatt-cli
+
+// Usage:
+// ./konlatt-cli [options] <file.cxt>...
+//
+// Options:
+// --layout layered|freese|redraw|multilevel (default: layered)
+// --placement simple|bk|ellipse (default: bk, layered layout only)
+// --layering longestPath|coffmanGraham|networkSimplex (default: longestPath, layered layout only)
+// --engine freese|redraw (default: freese, multilevel layout only)
+// --seed <number> (default: 42, ReDraw layout only)
+// --dimension 2|3 (default: 3, ReDraw layout only)
+// --crossings-time-budget <milliseconds> (default: 0, no limit, layered layout only)
+// --output-dir <directory> (default: directory of each input file)
+// --jobs <number> (default: number of hardware threads)
+// --format klay|project (default: klay)
+//
+// With --format project, the context, concepts, cover relation and layout of <name>.cxt are written
+// to a project file <name>.konlatt (see projectFile.h) that can be opened without recomputing anything.
+//
+// Otherwise, the layout of <name>.cxt is written to <name>.klay:
+//
+// char[4]  magic "KLAY"
+// uint32   format version
+// uint32   concepts count
+// uint32   supremum index
+// uint32   infimum index
+// uint32   coordinates count per concept (always 3)
+// float32  coordinates of all concepts (x, y, z of the first concept, x, y, z of the second concept, ...)
+// uint32   edges count
+// uint32   pairs of concept indexes (superconcept, subconcept) of all edges of the cover relation
+//
+// All numbers are stored in little-endian byte order.
+
+#include "../types/FormalConcept.h"
+#include "../types/FormalContext.h"
+#include "../types/TimedResult.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+
+#include <stdio.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "../utils.cpp"
+#include "../trace.cpp"
+#include "../memory.cpp"
+#include "../mappedFile.cpp"
+#include "../projectFile.cpp"
+#include "../parallel.cpp"
+#include "../burmeister.cpp"
+#include "../compressedExtent.cpp"
+#include "../inClose.cpp"
+#include "../conceptsCover.cpp"
+#include "../layout/utils.cpp"
+#include "../layout/convergence.cpp"
+#include "../layout/warmStart.cpp"
+#include "../layout/layers.cpp"
+#include "../layout/coffmanGrahamLayers.cpp"
+#include "../layout/networkSimplexLayers.cpp"
+#include "../layout/layered/crossCount.cpp"
+#include "../layout/layered/dummies.cpp"
+#include "../layout/layered/simplePlacement.cpp"
+#include "../layout/layered/bkPlacement.cpp"
+#include "../layout/layered/ellipsePlacement.cpp"
+#include "../layout/layered/layeredLayout.cpp"
+#include "../layout/freeseLayout.cpp"
+#include "../layout/reDrawLayout.cpp"
+#include "../layout/multilevelLayout.cpp"
+
+#define OUTPUT_FORMAT_VERSION 1
+#define OUTPUT_FILE_EXTENSION ".klay"
+#define DEFAULT_LAYERED_CROSSINGS_TIME_BUDGET 0
+#define LAYERED_RESTARTS_COUNT 0
+
+struct CliOptions {
+    std::string layout = "layered";
+    std::string placement = "bk";
+    std::string layering = "longestPath";
+    std::string engine = "freese";
+    unsigned int seed = 42;
+    int targetDimension = 3;
+    // Zero disables the time limit of the crossing reduction, so that the layered layouts do not depend on the machine speed and load
+    int crossingsTimeBudget = DEFAULT_LAYERED_CROSSINGS_TIME_BUDGET;
+    std::string outputDirectory;
+    int jobsCount = 0;
+    std::string format = "klay";
+    std::vector<std::string> inputFiles;
+};
+
+struct LatticeLayout {
+    int conceptsCount;
+    int supremum;
+    int infimum;
+    std::vector<float> coordinates;
+    // Pairs of (superconcept, subconcept) indexes
+    std::vector<std::pair<int, int>> edges;
+};
+
+void printUsage() {
+    std::cerr << "Usage: konlatt-cli [options] <file.cxt>..." << std::endl
+        << std::endl
+        << "Options:" << std::endl
+        << "  --layout layered|freese|redraw|multilevel   (default: layered)" << std::endl
+        << "  --placement simple|bk|ellipse                (default: bk)" << std::endl
+        << "  --layering longestPath|coffmanGraham|networkSimplex (default: longestPath)" << std::endl
+        << "  --engine freese|redraw                       (default: freese)" << std::endl
+        << "  --seed <number>                              (default: 42)" << std::endl
+        << "  --dimension 2|3                              (default: 3)" << std::endl
+        << "  --crossings-time-budget <milliseconds>       (default: 0, no limit, layouts are reproducible)" << std::endl
+        << "  --output-dir <directory>                     (default: directory of each input file)" << std::endl
+        << "  --jobs <number>                              (default: number of hardware threads)" << std::endl
+        << "  --format klay|project                        (default: klay)" << std::endl;
+}
+
+bool parseOptions(int argc, char* argv[], CliOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+
+        if (argument.rfind("--", 0) != 0) {
+            options.inputFiles.push_back(argument);
+            continue;
+        }
+
+        if (argument == "--help") {
+            return false;
+        }
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value of option " << argument << std::endl;
+            return false;
+        }
+
+        std::string value = argv[++i];
+
+        try {
+            if (argument == "--layout") {
+                options.layout = value;
+            }
+            else if (argument == "--placement") {
+                options.placement = value;
+            }
+            else if (argument == "--layering") {
+                options.layering = value;
+            }
+            else if (argument == "--engine") {
+                options.engine = value;
+            }
+            else if (argument == "--seed") {
+                options.seed = std::stoul(value);
+            }
+            else if (argument == "--dimension") {
+                options.targetDimension = std::stoi(value);
+            }
+            else if (argument == "--crossings-time-budget") {
+                options.crossingsTimeBudget = std::stoi(value);
+            }
+            else if (argument == "--output-dir") {
+                options.outputDirectory = value;
+            }
+            else if (argument == "--jobs") {
+                options.jobsCount = std::stoi(value);
+            }
+            else if (argument == "--format") {
+                options.format = value;
+            }
+            else {
+                std::cerr << "Unknown option " << argument << std::endl;
+                return false;
+            }
+        }
+        catch (const std::logic_error&) {
+            // std::invalid_argument or std::out_of_range thrown by the number conversions
+            std::cerr << "Invalid value " << value << " of option " << argument << std::endl;
+            return false;
+        }
+    }
+
+    if (options.layout != "layered" && options.layout != "freese" && options.layout != "redraw" && options.layout != "multilevel") {
+        std::cerr << "Unknown layout " << options.layout << std::endl;
+        return false;
+    }
+
+    if (options.placement != "simple" && options.placement != "bk" && options.placement != "ellipse") {
+        std::cerr << "Unknown placement " << options.placement << std::endl;
+        return false;
+    }
+
+    if (options.layering != "longestPath" && options.layering != "coffmanGraham" && options.layering != "networkSimplex") {
+        std::cerr << "Unknown layering " << options.layering << std::endl;
+        return false;
+    }
+
+    if (options.engine != "freese" && options.engine != "redraw") {
+        std::cerr << "Unknown engine " << options.engine << std::endl;
+        return false;
+    }
+
+    if (options.format != "klay" && options.format != "project") {
+        std::cerr << "Unknown format " << options.format << std::endl;
+        return false;
+    }
+
+    if (options.inputFiles.empty()) {
+        std::cerr << "No input files" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+std::string getFileName(const std::string& filePath) {
+    size_t separatorIndex = filePath.find_last_of("/\\");
+    size_t nameStart = separatorIndex == std::string::npos ? 0 : separatorIndex + 1;
+    size_t extensionIndex = filePath.find_last_of('.');
+    size_t nameEnd = extensionIndex == std::string::npos || extensionIndex < nameStart ? filePath.size() : extensionIndex;
+
+    return filePath.substr(nameStart, nameEnd - nameStart);
+}
+
+std::string getOutputFilePath(const std::string& inputFilePath, const std::string& outputDirectory, const std::string& extension) {
+    std::string name = getFileName(inputFilePath);
+
+    if (outputDirectory.empty()) {
+        size_t separatorIndex = inputFilePath.find_last_of("/\\");
+        size_t nameStart = separatorIndex == std::string::npos ? 0 : separatorIndex + 1;
+        return inputFilePath.substr(0, nameStart) + name + extension;
+    }
+
+    char lastCharacter = outputDirectory.back();
+    bool hasSeparator = lastCharacter == '/' || lastCharacter == '\\';
+
+    return outputDirectory + (hasSeparator ? "" : "/") + name + extension;
+}
+
+/**
+ * Identifies the options a layout was computed with, so that layouts with different options can be stored in a project file side by side.
+ */
+std::string getLayoutKey(const CliOptions& options) {
+    if (options.layout == "layered") {
+        return options.layout + ";" + options.placement + ";" + options.layering;
+    }
+    if (options.layout == "freese") {
+        return options.layout;
+    }
+    if (options.layout == "redraw") {
+        return options.layout + ";" + std::to_string(options.seed) + ";" + std::to_string(options.targetDimension);
+    }
+    return options.layout + ";" + options.engine + ";" + std::to_string(options.seed) + ";" + std::to_string(options.targetDimension);
+}
+
+/**
+ * @param project The context and concepts are added to the project when it is not null.
+ */
+void computeLatticeLayout(const std::string& inputFilePath, const CliOptions& options, LatticeLayout& layout, ProjectFileWriter* project) {
+    // The file is mapped into memory and parsed without copying its content
+    // Rows are parsed on multiple threads only when the other threads are not occupied by other files
+    auto context = parseBurmeisterFile(inputFilePath, true);
+    int objectsCount = context.getObjects().size();
+    int attributesCount = context.getAttributes().size();
+
+    TimedResult<std::vector<FormalConcept>> conceptsResult;
+    inClose(
+        conceptsResult,
+        context.getContext(),
+        context.getCellSize(),
+        context.getCellsPerObject(),
+        objectsCount,
+        attributesCount);
+
+    int conceptsCount = conceptsResult.value.size();
+    std::vector<SimpleFormalConcept> concepts(conceptsCount);
+
+    for (int i = 0; i < conceptsCount; i++) {
+        concepts[i].setObjects(conceptsResult.value[i].getObjects());
+        concepts[i].setAttributes(conceptsResult.value[i].getAttributes());
+    }
+
+    conceptsResult.value.clear();
+    conceptsResult.value.shrink_to_fit();
+
+    TimedResult<std::vector<std::vector<int>>> coverResult;
+    conceptsCover(
+        coverResult,
+        concepts,
+        context.getContext(),
+        context.getCellSize(),
+        context.getCellsPerObject(),
+        objectsCount,
+        attributesCount);
+
+    if (project) {
+        project->addContext(context, getFileName(inputFilePath));
+        project->addConcepts(concepts);
+    }
+
+    // The cover relation contains superconcepts of each concept
+    std::vector<std::unordered_set<int>> subconceptsMapping(conceptsCount);
+    std::vector<std::unordered_set<int>> superconceptsMapping(conceptsCount);
+
+    for (int concept = 0; concept < conceptsCount; concept++) {
+        for (int superconcept : coverResult.value[concept]) {
+            superconceptsMapping[concept].insert(superconcept);
+            subconceptsMapping[superconcept].insert(concept);
+        }
+    }
+
+    layout.conceptsCount = conceptsCount;
+    layout.supremum = 0;
+    layout.infimum = 0;
+
+    for (int concept = 0; concept < conceptsCount; concept++) {
+        if (superconceptsMapping[concept].empty()) {
+            layout.supremum = concept;
+        }
+        if (subconceptsMapping[concept].empty()) {
+            layout.infimum = concept;
+        }
+    }
+
+    // The edges are collected before the layout is computed because the layered layout adds dummy nodes to the mappings
+    for (int concept = 0; concept < conceptsCount; concept++) {
+        std::vector<int> subconcepts(subconceptsMapping[concept].begin(), subconceptsMapping[concept].end());
+        std::sort(subconcepts.begin(), subconcepts.end());
+
+        for (int subconcept : subconcepts) {
+            layout.edges.push_back({ concept, subconcept });
+        }
+    }
+
+    // The files are already processed in parallel, the layouts themselves are computed sequentially
+    auto onProgress = [](double) {};
+    ConvergenceCriteria convergenceCriteria(0.001, 0.0001, 0);
+
+    if (options.layout == "layered") {
+        TimedResult<std::vector<float>> result;
+        computeLayeredLayout(
+            result,
+            layout.supremum,
+            conceptsCount,
+            subconceptsMapping,
+            superconceptsMapping,
+            options.placement,
+            options.layering,
+            options.crossingsTimeBudget,
+            LAYERED_RESTARTS_COUNT,
+            onProgress);
+        layout.coordinates = std::move(result.value);
+    }
+    else if (options.layout == "freese") {
+        IterativeTimedResult<std::vector<float>> result;
+        computeFreeseLayout(
+            result,
+            layout.supremum,
+            layout.infimum,
+            conceptsCount,
+            subconceptsMapping,
+            superconceptsMapping,
+            convergenceCriteria,
+            std::nullopt,
+            onProgress);
+        layout.coordinates = std::move(result.value);
+    }
+    else if (options.layout == "redraw") {
+        IterativeTimedResult<std::vector<float>> result;
+        computeReDrawLayout(
+            result,
+            layout.supremum,
+            layout.infimum,
+            conceptsCount,
+            subconceptsMapping,
+            superconceptsMapping,
+            options.seed,
+            options.targetDimension,
+            false,
+            convergenceCriteria,
+            std::nullopt,
+            onProgress);
+        layout.coordinates = std::move(result.value);
+    }
+    else {
+        IterativeTimedResult<std::vector<float>> result;
+        computeMultilevelLayout(
+            result,
+            layout.supremum,
+            layout.infimum,
+            conceptsCount,
+            subconceptsMapping,
+            superconceptsMapping,
+            options.engine,
+            options.seed,
+            options.targetDimension,
+            false,
+            convergenceCriteria,
+            onProgress);
+        layout.coordinates = std::move(result.value);
+    }
+}
+
+void writeUInt32(std::ostream& stream, uint32_t value) {
+    unsigned char bytes[4] = {
+        (unsigned char)(value & 0xFF),
+        (unsigned char)((value >> 8) & 0xFF),
+        (unsigned char)((value >> 16) & 0xFF),
+        (unsigned char)((value >> 24) & 0xFF),
+    };
+    stream.write(reinterpret_cast<const char*>(bytes), 4);
+}
+
+void writeFloat32(std::ostream& stream, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeUInt32(stream, bits);
+}
+
+void writeLatticeLayout(const std::string& filePath, const LatticeLayout& layout) {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create the output file " + filePath);
+    }
+
+    file.write("KLAY", 4);
+    writeUInt32(file, OUTPUT_FORMAT_VERSION);
+    writeUInt32(file, layout.conceptsCount);
+    writeUInt32(file, layout.supremum);
+    writeUInt32(file, layout.infimum);
+    writeUInt32(file, COORDS_COUNT);
+
+    for (float coordinate : layout.coordinates) {
+        writeFloat32(file, coordinate);
+    }
+
+    writeUInt32(file, layout.edges.size());
+
+    for (auto& [superconcept, subconcept] : layout.edges) {
+        writeUInt32(file, superconcept);
+        writeUInt32(file, subconcept);
+    }
+
+    if (!file.good()) {
+        throw std::runtime_error("Cannot write the output file " + filePath);
+    }
+}
+
+void writeProject(const std::string& filePath, const LatticeLayout& layout, const std::string& layoutKey, ProjectFileWriter& project) {
+    // The edges are grouped by superconcepts
+    std::vector<std::vector<int>> subconceptsMapping(layout.conceptsCount);
+
+    for (auto& [superconcept, subconcept] : layout.edges) {
+        subconceptsMapping[superconcept].push_back(subconcept);
+    }
+
+    project.addCover(subconceptsMapping);
+    project.addLayout(layoutKey, layout.coordinates);
+    project.writeToFile(filePath);
+}
+
+int main(int argc, char* argv[]) {
+    CliOptions options;
+
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    int filesCount = options.inputFiles.size();
+    int threadsCount = options.jobsCount > 0 ?
+        std::min(options.jobsCount, filesCount) :
+        getThreadsCount(filesCount);
+
+    std::atomic<int> nextFileIndex(0);
+    std::atomic<int> failedFilesCount(0);
+    std::mutex outputMutex;
+
+    // Each thread takes the next unprocessed file, so that a few large files do not block the small ones
+    runInParallel(threadsCount, [&](int threadIndex) {
+        while (true) {
+            int fileIndex = nextFileIndex.fetch_add(1);
+
+            if (fileIndex >= filesCount) {
+                break;
+            }
+
+            const std::string& inputFilePath = options.inputFiles[fileIndex];
+            long long startTime = nowMills();
+
+            try {
+                bool isProject = options.format == "project";
+                LatticeLayout layout;
+                ProjectFileWriter project;
+                computeLatticeLayout(inputFilePath, options, layout, isProject ? &project : nullptr);
+
+                std::string outputFilePath = getOutputFilePath(
+                    inputFilePath,
+                    options.outputDirectory,
+                    isProject ? PROJECT_FILE_EXTENSION : OUTPUT_FILE_EXTENSION);
+
+                if (isProject) {
+                    writeProject(outputFilePath, layout, getLayoutKey(options), project);
+                }
+                else {
+                    writeLatticeLayout(outputFilePath, layout);
+                }
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                std::cout << inputFilePath << " -> " << outputFilePath << " ("
+                    << layout.conceptsCount << " concepts, "
+                    << nowMills() - startTime << " ms)" << std::endl;
+            }
+            catch (const std::exception& exception) {
+                failedFilesCount++;
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                std::cerr << inputFilePath << ": " << exception.what() << std::endl;
+            }
+        }
+    });
+
+    return failedFilesCount > 0 ? 1 : 0;
+}
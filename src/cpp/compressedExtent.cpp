@@ -0,0 +1,286 @@
+#include "compressedExtent.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#define ARRAY_VALUE_BYTES 2
+#define RUN_BYTES 4
+#define BITMAP_BYTES (COMPRESSED_EXTENT_CHUNK_SIZE / 8)
+
+#define CONTAINER_HEADER_SIZE 4
+
+inline uint64_t getBitmapWord(const uint16_t* data, int index) {
+    uint64_t word;
+    std::memcpy(&word, data + (index * 4), sizeof(word));
+    return word;
+}
+
+/// @brief Writes objects of the set bits of the word to the output.
+inline size_t writeBitmapWord(uint64_t word, int firstObject, int* output) {
+    size_t count = 0;
+
+    while (word != 0) {
+        // GCC and Clang (including emcc) compile this to a single instruction
+        output[count++] = firstObject + __builtin_ctzll(word);
+        word &= word - 1;
+    }
+
+    return count;
+}
+
+/// @brief Counts runs of consecutive objects.
+inline size_t countRuns(const int* objects, size_t count) {
+    size_t runsCount = 1;
+
+    for (size_t i = 1; i < count; i++) {
+        if (objects[i] != objects[i - 1] + 1) {
+            runsCount++;
+        }
+    }
+
+    return runsCount;
+}
+
+/// @returns End of the chunk that starts at the object.
+inline size_t findChunkEnd(const int* objects, size_t start, size_t count) {
+    int key = objects[start] >> COMPRESSED_EXTENT_CHUNK_BITS;
+    size_t end = start + 1;
+
+    while (end < count && (objects[end] >> COMPRESSED_EXTENT_CHUNK_BITS) == key) {
+        end++;
+    }
+
+    return end;
+}
+
+void CompressedExtent::assign(const int* objects, size_t count) {
+    cardinality = count;
+    buffer.clear();
+
+    // The size of the buffer is computed first, so that it is allocated exactly
+    size_t bufferSize = 0;
+
+    for (size_t start = 0; start < count;) {
+        size_t end = findChunkEnd(objects, start, count);
+        size_t runsCount = countRuns(objects + start, end - start);
+
+        bufferSize += CONTAINER_HEADER_SIZE + getContainerSize(getContainerType(end - start, runsCount), end - start, runsCount);
+        start = end;
+    }
+
+    buffer.reserve(bufferSize);
+
+    for (size_t start = 0; start < count;) {
+        size_t end = findChunkEnd(objects, start, count);
+
+        writeContainer(objects[start] >> COMPRESSED_EXTENT_CHUNK_BITS, objects + start, end - start, countRuns(objects + start, end - start));
+        start = end;
+    }
+}
+
+CompressedExtent::ContainerType CompressedExtent::getContainerType(size_t count, size_t runsCount) {
+    size_t arrayBytes = count * ARRAY_VALUE_BYTES;
+    size_t runBytes = runsCount * RUN_BYTES;
+
+    if (runBytes < arrayBytes && runBytes < BITMAP_BYTES) {
+        return ContainerType::Run;
+    }
+    if (arrayBytes <= BITMAP_BYTES) {
+        return ContainerType::Array;
+    }
+    return ContainerType::Bitmap;
+}
+
+size_t CompressedExtent::getContainerSize(ContainerType type, size_t count, size_t runsCount) {
+    switch (type) {
+        case ContainerType::Array:
+            return count;
+        case ContainerType::Bitmap:
+            return COMPRESSED_EXTENT_BITMAP_WORDS * 4;
+        case ContainerType::Run:
+            return runsCount * 2;
+    }
+    return 0;
+}
+
+void CompressedExtent::writeContainer(uint16_t key, const int* objects, size_t count, size_t runsCount) {
+    ContainerType type = getContainerType(count, runsCount);
+    size_t size = getContainerSize(type, count, runsCount);
+
+    buffer.push_back(key);
+    buffer.push_back((uint16_t)type);
+    buffer.push_back(size & 0xFFFF);
+    buffer.push_back(size >> 16);
+
+    switch (type) {
+        case ContainerType::Run: {
+            size_t runStart = 0;
+
+            for (size_t i = 1; i <= count; i++) {
+                if (i == count || objects[i] != objects[i - 1] + 1) {
+                    buffer.push_back(objects[runStart] & 0xFFFF);
+                    buffer.push_back(i - runStart - 1);
+                    runStart = i;
+                }
+            }
+            break;
+        }
+        case ContainerType::Array:
+            for (size_t i = 0; i < count; i++) {
+                buffer.push_back(objects[i] & 0xFFFF);
+            }
+            break;
+        case ContainerType::Bitmap: {
+            std::vector<uint64_t> words(COMPRESSED_EXTENT_BITMAP_WORDS, 0);
+
+            for (size_t i = 0; i < count; i++) {
+                int value = objects[i] & 0xFFFF;
+                words[value >> 6] |= 1ULL << (value & 63);
+            }
+
+            size_t position = buffer.size();
+            buffer.resize(position + size);
+            std::memcpy(buffer.data() + position, words.data(), BITMAP_BYTES);
+            break;
+        }
+    }
+}
+
+CompressedExtent::Container CompressedExtent::readContainer(const std::vector<uint16_t>& buffer, size_t& position) {
+    Container container;
+    container.key = buffer[position];
+    container.type = (ContainerType)buffer[position + 1];
+    container.size = buffer[position + 2] | ((size_t)buffer[position + 3] << 16);
+    container.data = buffer.data() + position + CONTAINER_HEADER_SIZE;
+
+    position += CONTAINER_HEADER_SIZE + container.size;
+
+    return container;
+}
+
+size_t CompressedExtent::intersectContainer(const Container& container, const uint64_t* bitset, size_t wordsCount, int* output) {
+    int base = container.key << COMPRESSED_EXTENT_CHUNK_BITS;
+    size_t count = 0;
+
+    switch (container.type) {
+        case ContainerType::Array:
+            for (uint16_t value : container) {
+                int object = base + value;
+
+                if ((bitset[object >> 6] >> (object & 63)) & 1) {
+                    output[count++] = object;
+                }
+            }
+            break;
+        case ContainerType::Bitmap: {
+            // The bitset may end before the chunk, its missing words would be empty anyway
+            size_t firstWord = base >> 6;
+            size_t chunkWordsCount = std::min<size_t>(COMPRESSED_EXTENT_BITMAP_WORDS, wordsCount - firstWord);
+
+            for (size_t w = 0; w < chunkWordsCount; w++) {
+                uint64_t word = getBitmapWord(container.data, w) & bitset[firstWord + w];
+                count += writeBitmapWord(word, base + (w * 64), output + count);
+            }
+            break;
+        }
+        case ContainerType::Run:
+            for (size_t i = 0; i < container.size; i += 2) {
+                int start = base + container.data[i];
+                int end = start + container.data[i + 1];
+                int firstWord = start >> 6;
+                int lastWord = end >> 6;
+
+                for (int w = firstWord; w <= lastWord; w++) {
+                    uint64_t word = bitset[w];
+
+                    if (w == firstWord) {
+                        word &= ~0ULL << (start & 63);
+                    }
+                    if (w == lastWord && (end & 63) != 63) {
+                        word &= (1ULL << ((end & 63) + 1)) - 1;
+                    }
+
+                    count += writeBitmapWord(word, w * 64, output + count);
+                }
+            }
+            break;
+    }
+
+    return count;
+}
+
+size_t CompressedExtent::intersect(const uint64_t* bitset, size_t wordsCount, int* output) const {
+    size_t count = 0;
+
+    for (size_t position = 0; position < buffer.size();) {
+        Container container = readContainer(buffer, position);
+
+        if ((size_t)(container.key << COMPRESSED_EXTENT_CHUNK_BITS) >> 6 >= wordsCount) {
+            break;
+        }
+
+        count += intersectContainer(container, bitset, wordsCount, output + count);
+    }
+
+    return count;
+}
+
+size_t CompressedExtent::writeContainerObjects(const Container& container, int* output) {
+    int base = container.key << COMPRESSED_EXTENT_CHUNK_BITS;
+    size_t count = 0;
+
+    switch (container.type) {
+        case ContainerType::Array:
+            for (uint16_t value : container) {
+                output[count++] = base + value;
+            }
+            break;
+        case ContainerType::Bitmap:
+            for (int w = 0; w < COMPRESSED_EXTENT_BITMAP_WORDS; w++) {
+                count += writeBitmapWord(getBitmapWord(container.data, w), base + (w * 64), output + count);
+            }
+            break;
+        case ContainerType::Run:
+            for (size_t i = 0; i < container.size; i += 2) {
+                for (int value = container.data[i]; value <= container.data[i] + container.data[i + 1]; value++) {
+                    output[count++] = base + value;
+                }
+            }
+            break;
+    }
+
+    return count;
+}
+
+void CompressedExtent::toVector(std::vector<int>& objects) const {
+    objects.resize(cardinality);
+    size_t count = 0;
+
+    for (size_t position = 0; position < buffer.size();) {
+        Container container = readContainer(buffer, position);
+        count += writeContainerObjects(container, objects.data() + count);
+    }
+}
+
+std::vector<int> CompressedExtent::toVector() const {
+    std::vector<int> objects;
+    toVector(objects);
+    return objects;
+}
+
+size_t CompressedExtent::hash() const {
+    // FNV-1a over the buffer, equal sets have equal buffers
+    uint64_t hash = 14695981039346656037ULL ^ cardinality;
+
+    for (uint16_t value : buffer) {
+        hash = (hash ^ value) * 1099511628211ULL;
+    }
+
+    return (size_t)hash;
+}
+
+bool CompressedExtent::operator==(const CompressedExtent& other) const {
+    return cardinality == other.cardinality && buffer == other.buffer;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef COMPRESSED_EXTENT_H
+#define COMPRESSED_EXTENT_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Objects are split into chunks of 2^16 by their upper 16 bits (as in Roaring bitmaps)
+// and each non-empty chunk is stored in the smallest of three containers:
+// - Array: sorted lower 16 bits of the objects, for sparse chunks
+// - Bitmap: 2^16 bits, for dense chunks
+// - Run: pairs of (start, length - 1) of consecutive objects, for chunks of long runs, e.g. near the top of a lattice
+
+#define COMPRESSED_EXTENT_CHUNK_BITS 16
+#define COMPRESSED_EXTENT_CHUNK_SIZE (1 << COMPRESSED_EXTENT_CHUNK_BITS)
+#define COMPRESSED_EXTENT_BITMAP_WORDS (COMPRESSED_EXTENT_CHUNK_SIZE / 64)
+
+/**
+ * Compressed set of objects with fast intersection with a bitset.
+ * Equal sets always have the same representation, so they can be compared and hashed directly.
+ */
+class CompressedExtent {
+public:
+    CompressedExtent() {}
+    /// @param objects Sorted objects.
+    CompressedExtent(const int* objects, size_t count) { assign(objects, count); }
+    CompressedExtent(const std::vector<int>& objects) : CompressedExtent(objects.data(), objects.size()) {}
+
+    /// @brief Replaces the objects, the already allocated memory is reused if it is large enough.
+    void assign(const int* objects, size_t count);
+
+    size_t size() const { return cardinality; }
+    bool empty() const { return cardinality == 0; }
+
+    /**
+     * Writes the sorted intersection with a plain bitset of objects to the output.
+     * Bit (object % 64) of word (object / 64) is set for each object of the bitset.
+     * @returns Size of the intersection.
+     */
+    size_t intersect(const uint64_t* bitset, size_t wordsCount, int* output) const;
+
+    void toVector(std::vector<int>& objects) const;
+    std::vector<int> toVector() const;
+
+    size_t hash() const;
+    bool operator==(const CompressedExtent& other) const;
+    bool operator!=(const CompressedExtent& other) const { return !(*this == other); }
+
+private:
+    enum class ContainerType : uint16_t {
+        Array,
+        Bitmap,
+        Run,
+    };
+
+    // The containers are stored one after another in a single buffer, so that each extent needs only one allocation:
+    // uint16 key, uint16 type, uint16 low and high half of the data size, data
+    struct Container {
+        uint16_t key;
+        ContainerType type;
+        // Array: sorted values, Bitmap: 64-bit words stored as 16-bit values, Run: pairs of start and length - 1
+        const uint16_t* data;
+        size_t size;
+
+        const uint16_t* begin() const { return data; }
+        const uint16_t* end() const { return data + size; }
+    };
+
+    static Container readContainer(const std::vector<uint16_t>& buffer, size_t& position);
+    static size_t getContainerSize(ContainerType type, size_t count, size_t runsCount);
+    static ContainerType getContainerType(size_t count, size_t runsCount);
+    void writeContainer(uint16_t key, const int* objects, size_t count, size_t runsCount);
+
+    static size_t intersectContainer(const Container& container, const uint64_t* bitset, size_t wordsCount, int* output);
+    static size_t writeContainerObjects(const Container& container, int* output);
+
+    std::vector<uint16_t> buffer;
+    size_t cardinality = 0;
+};
+
+struct CompressedExtentHash {
+    size_t operator()(const CompressedExtent& extent) const { return extent.hash(); }
+};
+
+#endif
\ No newline at end of file
@@ -3,7 +3,10 @@
 // - https://www.researchgate.net/publication/220693390_Romano_G_Concept_Data_Analysis_Theory_and_Applications_Wiley_New_York
 
 #include "types/FormalConcept.h"
+#include "compressedExtent.h"
 #include "utils.h"
+#include "memory.h"
+#include "trace.h"
 #include "conceptsCover.h"
 
 #include <stdio.h>
@@ -12,7 +15,7 @@
 #include <algorithm>
 #include <memory>
 #include <unordered_set>
-#include <map>
+#include <unordered_map>
 
 void conceptsCover(
     TimedResult<std::vector<std::vector<int>>>& result,
@@ -27,19 +30,39 @@ void conceptsCover(
 #endif
 ) {
     //printFormalContext(contextMatrix, cellSize, cellsPerObject, contextObjectsCount, contextAttributesCount);
+    TRACE_SCOPE("conceptsCover");
     long long startTime = nowMills();
+    MemoryTracker memoryTracker;
 
-    std::map<std::vector<int>, int> conceptsMap;
+    // Concepts are looked up by their compressed extents, which take a fraction of the memory of copied extents
+    std::unordered_map<CompressedExtent, int, CompressedExtentHash> conceptsMap;
+    std::vector<const CompressedExtent*> conceptExtents(concepts.size());
+    std::vector<uint64_t> attributeBitsets;
 
-    for (int i = 0; i < concepts.size(); i++) {
-        conceptsMap.insert({ concepts[i].getObjectsCopy(), i });
+    {
+        TRACE_SCOPE("conceptsCover.buildMap");
+
+        conceptsMap.reserve(concepts.size());
+
+        for (int i = 0; i < concepts.size(); i++) {
+            auto inserted = conceptsMap.emplace(CompressedExtent(concepts[i].getObjects()), i);
+            conceptExtents[i] = &inserted.first->first;
+        }
+
+        attributeBitsets = getAttributeBitsets(
+            contextMatrix,
+            cellSize,
+            cellsPerObject,
+            contextObjectsCount,
+            contextAttributesCount);
     }
 
     result.value.resize(concepts.size());
 
+    size_t attributeWordsCount = (contextObjectsCount + 63) / 64;
     std::vector<int> counts(concepts.size(), 0);
-    std::vector<int> inters;
-    inters.reserve(contextObjectsCount);
+    std::vector<int> inters(contextObjectsCount);
+    CompressedExtent intersExtent;
 
 #ifdef __EMSCRIPTEN__
     int progressStep = concepts.size() / 100;
@@ -69,21 +92,15 @@ void conceptsCover(
             }
 
             // all objects of concepts[i] that have attribute m
-            inters.clear();
-            for (int object : concepts[i].getObjects()) {
-                if (formalContextHasAttribute(
-                    contextMatrix,
-                    cellSize,
-                    cellsPerObject,
-                    object,
-                    m
-                )) {
-                    inters.push_back(object);
-                }
-            }
+            size_t intersSize = conceptExtents[i]->intersect(
+                attributeBitsets.data() + (m * attributeWordsCount),
+                attributeWordsCount,
+                inters.data());
+            intersExtent.assign(inters.data(), intersSize);
 
             // getting concept whose extent is equal to inters
-            int anotherConceptIndex = conceptsMap.find(inters)->second;
+            int anotherConceptIndex = conceptsMap.find(intersExtent)->second;
+            TRACE_COUNTER("conceptsCover.mapProbes", 1);
             counts[anotherConceptIndex] = counts[anotherConceptIndex] + 1;
 
             if (concepts[anotherConceptIndex].getAttributes().size() - conceptAttributesCount == counts[anotherConceptIndex]) {
@@ -102,4 +119,5 @@ void conceptsCover(
 #endif
 
     result.time = (int)endTime - startTime;
+    result.memory = memoryTracker.finish();
 }
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "types/FormalContext.h"
+#include "contextParsing.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <climits>
+#include <cctype>
+
+FormalContext createFormalContext(
+    std::vector<std::string> objects,
+    std::vector<std::string> attributes,
+    const std::vector<std::pair<int, int>>& relation
+) {
+    FormalContext context;
+
+    int cellSize = sizeof(unsigned int) * 8;
+    int cellsPerObject = ((int)attributes.size() + cellSize - 1) / cellSize;
+    std::vector<unsigned int> contextMatrix(objects.size() * cellsPerObject, 0u);
+
+    for (auto [object, attribute] : relation) {
+        contextMatrix[(object * cellsPerObject) + (attribute / cellSize)] |= 1u << (attribute % cellSize);
+    }
+
+    // The setters copy the vectors, large contexts are moved instead
+    context.getObjects() = std::move(objects);
+    context.getAttributes() = std::move(attributes);
+    context.getContext() = std::move(contextMatrix);
+    context.setCellsPerObject(cellsPerObject);
+    context.setCellSize(cellSize);
+
+    return context;
+}
+
+int parseIndex(std::string_view value) {
+    size_t position = 0;
+
+    while (position < value.size() && std::isspace((unsigned char)value[position])) {
+        position++;
+    }
+
+    if (position == value.size() || !std::isdigit((unsigned char)value[position])) {
+        return -1;
+    }
+
+    long long index = 0;
+
+    for (; position < value.size() && std::isdigit((unsigned char)value[position]); position++) {
+        index = (index * 10) + (value[position] - '0');
+
+        if (index > INT_MAX) {
+            return -1;
+        }
+    }
+
+    return (int)index;
+}
\ No newline at end of file
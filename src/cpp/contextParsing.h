@@ -0,0 +1,27 @@
+#ifndef CONTEXT_PARSING_H
+#define CONTEXT_PARSING_H
+
+#include "types/FormalContext.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+
+/**
+ * Packs the object-attribute pairs of a relation into a formal context.
+ * The pairs have to be validated against the numbers of objects and attributes beforehand.
+ */
+FormalContext createFormalContext(
+    std::vector<std::string> objects,
+    std::vector<std::string> attributes,
+    const std::vector<std::pair<int, int>>& relation);
+
+/**
+ * Reads a non-negative integer at the start of the value, like parseInt() of JavaScript.
+ * Leading whitespace is skipped and the characters after the digits are ignored.
+ *
+ * @return -1 if the value does not start with a digit or if the integer does not fit into int.
+ */
+int parseIndex(std::string_view value);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "types/ParsedContext.h"
+#include "contextParsing.h"
+#include "csv.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <stdexcept>
+
+/// @brief Returns the index of the name, a new index is assigned to a name that has not been seen yet.
+/// The names are views of the file content, so they are copied only once.
+int getOrAddName(std::unordered_map<std::string_view, int>& indexes, std::vector<std::string_view>& names, std::string_view name) {
+    auto [iterator, inserted] = indexes.try_emplace(name, (int)names.size());
+
+    if (inserted) {
+        names.push_back(name);
+    }
+
+    return iterator->second;
+}
+
+std::vector<std::string> copyNames(const std::vector<std::string_view>& names) {
+    std::vector<std::string> result;
+    result.reserve(names.size());
+
+    for (auto name : names) {
+        result.emplace_back(name);
+    }
+
+    return result;
+}
+
+void parseCsv(ParsedContext& result, std::string_view fileContent, char separator) {
+    std::unordered_map<std::string_view, int> objectIndexes;
+    std::unordered_map<std::string_view, int> attributeIndexes;
+    std::vector<std::string_view> objects;
+    std::vector<std::string_view> attributes;
+    std::vector<std::pair<int, int>> relation;
+    size_t position = 0;
+    int lastObject = -1;
+
+    // Every line, including an empty content, has to be a pair, only a single line break may end the file
+    do {
+        size_t end = fileContent.find('\n', position);
+
+        if (end == std::string_view::npos) {
+            end = fileContent.size();
+        }
+
+        std::string_view line = fileContent.substr(position, end - position);
+        position = end + 1;
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+
+        size_t separatorPosition = line.find(separator);
+
+        if (separatorPosition == std::string_view::npos || line.find(separator, separatorPosition + 1) != std::string_view::npos) {
+            throw std::invalid_argument("Invalid separator.");
+        }
+
+        std::string_view objectName = line.substr(0, separatorPosition);
+
+        // Pairs of an object are usually on consecutive lines, the lookup of the same name can be skipped
+        int object = lastObject >= 0 && objects[lastObject] == objectName ?
+            lastObject :
+            getOrAddName(objectIndexes, objects, objectName);
+        lastObject = object;
+        int attribute = getOrAddName(attributeIndexes, attributes, line.substr(separatorPosition + 1));
+
+        relation.push_back({ object, attribute });
+    } while (position < fileContent.size());
+
+    result.context = createFormalContext(copyNames(objects), copyNames(attributes), relation);
+}
\ No newline at end of file
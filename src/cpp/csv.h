@@ -0,0 +1,15 @@
+#ifndef CSV_H
+#define CSV_H
+
+#include "types/ParsedContext.h"
+#include <string_view>
+
+/**
+ * Parses a CSV file with one object-attribute pair per line.
+ * Objects and attributes are numbered in the order of their first occurrence.
+ *
+ * @throws std::invalid_argument if a line does not consist of exactly two values.
+ */
+void parseCsv(ParsedContext& result, std::string_view fileContent, char separator);
+
+#endif
\ No newline at end of file
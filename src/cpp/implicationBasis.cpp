@@ -0,0 +1,475 @@
+// Implementation of the NextClosure algorithm for the Duquenne-Guigues basis,
+// the attribute sets are closed under the implications by the LinClosure algorithm:
+// - https://link.springer.com/chapter/10.1007/978-3-642-11928-6_22 (Two Basic Algorithms in Concept Analysis)
+// - https://link.springer.com/article/10.1007/s10472-011-9257-8 (Optimizations in computing the Duquenne-Guigues basis of implications)
+
+#include "utils.h"
+#include "memory.h"
+#include "trace.h"
+#include "implicationBasis.h"
+#include "types/Implication.h"
+#include "types/TimedResult.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * Implications found so far, indexed for the LinClosure algorithm.
+ * Each implication has a counter of its premise attributes that are missing in the current set,
+ * the counters are updated only when an attribute is added to or removed from the current set.
+ * Most candidate closures of NextClosure are rejected, so a candidate closure works on its own copies of the counters,
+ * which are taken lazily on the first update and are valid only in the epoch of the closure.
+ */
+struct ImplicationIndex {
+    int wordsCount;
+    // Implications whose premise contains the attribute
+    std::vector<std::vector<int>> attributeImplications;
+    std::vector<int> premiseSizes;
+    std::vector<int> maxPremiseAttributes;
+    // wordsCount words per implication
+    std::vector<uint64_t> conclusions;
+    std::vector<int> counts;
+    std::vector<int> candidateCounts;
+    std::vector<unsigned int> countEpochs;
+    unsigned int epoch = 0;
+
+    ImplicationIndex(int attributesCount) :
+        wordsCount((attributesCount + 63) / 64),
+        attributeImplications(attributesCount) {}
+};
+
+/**
+ * Attribute set that is enumerated by NextClosure, with the buffers of its closing.
+ */
+struct ClosureState {
+    std::vector<uint64_t> set;
+    int size = 0;
+    // Implications whose premises are subsets of the set, sorted by their greatest premise attribute
+    std::vector<int> readyImplications;
+    // Unions of the conclusions of the first k ready implications, wordsCount words per union
+    std::vector<uint64_t> readyConclusions;
+
+    std::vector<int> queue;
+    std::vector<int> touchedImplications;
+    std::vector<int> reachedImplications;
+    std::vector<int> pendingImplications;
+
+    ClosureState(int wordsCount) : set(wordsCount, 0) {}
+};
+
+inline bool hasBit(const std::vector<uint64_t>& bitset, int index) {
+    return (bitset[index >> 6] & (1ULL << (index & 63))) != 0;
+}
+
+inline void setBit(std::vector<uint64_t>& bitset, int index) {
+    bitset[index >> 6] |= 1ULL << (index & 63);
+}
+
+inline void clearBit(std::vector<uint64_t>& bitset, int index) {
+    bitset[index >> 6] &= ~(1ULL << (index & 63));
+}
+
+std::vector<int> bitsetToVector(const std::vector<uint64_t>& bitset) {
+    std::vector<int> indexes;
+
+    for (int w = 0; w < bitset.size(); w++) {
+        uint64_t word = bitset[w];
+
+        while (word != 0) {
+            indexes.push_back((w << 6) + __builtin_ctzll(word));
+            word &= word - 1;
+        }
+    }
+
+    return indexes;
+}
+
+/**
+ * Adds the conclusion to the set.
+ * @returns False if an attribute lower than the candidate attribute would be added, i.e. the closure is not the next set in the lectic order.
+ */
+bool addConclusion(ClosureState& state, const uint64_t* conclusion, int wordsCount, int candidateAttribute) {
+    for (int w = 0; w < wordsCount; w++) {
+        uint64_t newAttributes = conclusion[w] & ~state.set[w];
+
+        while (newAttributes != 0) {
+            int attribute = (w << 6) + __builtin_ctzll(newAttributes);
+            newAttributes &= newAttributes - 1;
+
+            if (attribute < candidateAttribute) {
+                return false;
+            }
+
+            setBit(state.set, attribute);
+            state.size++;
+            state.queue.push_back(attribute);
+        }
+    }
+
+    return true;
+}
+
+bool fireImplication(ImplicationIndex& index, ClosureState& state, int implication, int candidateAttribute) {
+    return addConclusion(
+        state,
+        index.conclusions.data() + ((size_t)implication * index.wordsCount),
+        index.wordsCount,
+        candidateAttribute);
+}
+
+/**
+ * Closes the set with the candidate attribute under the implications (the premises have to be proper subsets of the closure).
+ * The set has to contain only the attributes lower than the candidate attribute, the counters have to match the set.
+ * If the closure is not the next set in the lectic order, the set is restored and the counters are left unchanged.
+ * @returns Whether the closure is the next set in the lectic order.
+ */
+bool closeCandidate(ImplicationIndex& index, ClosureState& state, int candidateAttribute) {
+    TRACE_COUNTER("duquenneGuiguesBasis.closures", 1);
+
+    state.queue.clear();
+    state.touchedImplications.clear();
+    state.reachedImplications.clear();
+    state.pendingImplications.clear();
+
+    index.epoch++;
+    if (index.epoch == 0) {
+        std::fill(index.countEpochs.begin(), index.countEpochs.end(), 0);
+        index.epoch = 1;
+    }
+
+    setBit(state.set, candidateAttribute);
+    state.size++;
+    state.queue.push_back(candidateAttribute);
+
+    // The premises of the ready implications with lower attributes than the candidate attribute are subsets of the set,
+    // so all their conclusions are added at once
+    int readyCount = 0;
+
+    while (readyCount < state.readyImplications.size() &&
+        index.maxPremiseAttributes[state.readyImplications[readyCount]] < candidateAttribute) {
+        readyCount++;
+    }
+
+    bool isNext = addConclusion(
+        state,
+        state.readyConclusions.data() + ((size_t)readyCount * index.wordsCount),
+        index.wordsCount,
+        candidateAttribute);
+
+    for (int i = 0; isNext && i < state.queue.size(); i++) {
+        int sizeBefore = state.size;
+
+        for (int implication : index.attributeImplications[state.queue[i]]) {
+            if (index.countEpochs[implication] != index.epoch) {
+                index.countEpochs[implication] = index.epoch;
+                index.candidateCounts[implication] = index.counts[implication];
+                state.touchedImplications.push_back(implication);
+            }
+
+            if (--index.candidateCounts[implication] != 0) {
+                continue;
+            }
+
+            state.reachedImplications.push_back(implication);
+
+            if (index.premiseSizes[implication] < state.size) {
+                if (!fireImplication(index, state, implication, candidateAttribute)) {
+                    isNext = false;
+                    break;
+                }
+            }
+            else {
+                // The premise is equal to the set, the implication can be applied only when the set grows
+                state.pendingImplications.push_back(implication);
+            }
+        }
+
+        if (isNext && state.size > sizeBefore) {
+            for (int implication : state.pendingImplications) {
+                if (!fireImplication(index, state, implication, candidateAttribute)) {
+                    isNext = false;
+                    break;
+                }
+            }
+            state.pendingImplications.clear();
+        }
+    }
+
+    if (!isNext) {
+        TRACE_COUNTER("duquenneGuiguesBasis.failedClosures", 1);
+
+        for (int attribute : state.queue) {
+            clearBit(state.set, attribute);
+        }
+        state.size -= state.queue.size();
+
+        return false;
+    }
+
+    for (int implication : state.touchedImplications) {
+        index.counts[implication] = index.candidateCounts[implication];
+    }
+
+    state.readyImplications.resize(readyCount);
+    state.readyImplications.insert(state.readyImplications.end(), state.reachedImplications.begin(), state.reachedImplications.end());
+    std::sort(state.readyImplications.begin(), state.readyImplications.end(), [&index](int first, int second) {
+        return index.maxPremiseAttributes[first] < index.maxPremiseAttributes[second];
+    });
+
+    return true;
+}
+
+/**
+ * Replaces the set with the next set in the lectic order that is closed under the implications.
+ * @returns False if the set contains all the attributes.
+ */
+bool nextClosure(ImplicationIndex& index, ClosureState& state, int attributesCount) {
+    state.readyConclusions.assign((state.readyImplications.size() + 1) * index.wordsCount, 0);
+
+    for (int i = 0; i < state.readyImplications.size(); i++) {
+        const uint64_t* conclusion = index.conclusions.data() + ((size_t)state.readyImplications[i] * index.wordsCount);
+        uint64_t* previousUnion = state.readyConclusions.data() + ((size_t)i * index.wordsCount);
+
+        for (int w = 0; w < index.wordsCount; w++) {
+            previousUnion[w + index.wordsCount] = previousUnion[w] | conclusion[w];
+        }
+    }
+
+    for (int attribute = attributesCount - 1; attribute >= 0; attribute--) {
+        if (hasBit(state.set, attribute)) {
+            clearBit(state.set, attribute);
+            state.size--;
+
+            for (int implication : index.attributeImplications[attribute]) {
+                index.counts[implication]++;
+            }
+        }
+        else if (closeCandidate(index, state, attribute)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Computes the closure of the attribute set in the context, i.e. the attributes common to all objects having the attributes of the set.
+ * @param objectBitsets Bitsets of the attributes of each object, attributeWordsCount words per object.
+ */
+void closeInContext(
+    const std::vector<uint64_t>& set,
+    const std::vector<uint64_t>& attributeBitsets,
+    const std::vector<uint64_t>& objectBitsets,
+    int contextObjectsCount,
+    int contextAttributesCount,
+    std::vector<uint64_t>& extent,
+    std::vector<uint64_t>& closure
+) {
+    int objectWordsCount = extent.size();
+    int attributeWordsCount = closure.size();
+
+    std::fill(extent.begin(), extent.end(), ~0ULL);
+    if (contextObjectsCount % 64 != 0) {
+        extent.back() = (1ULL << (contextObjectsCount % 64)) - 1;
+    }
+
+    int extentSize = contextObjectsCount;
+
+    for (int w = 0; w < attributeWordsCount && extentSize > 0; w++) {
+        uint64_t word = set[w];
+
+        while (word != 0) {
+            const uint64_t* attributeObjects = attributeBitsets.data() + ((size_t)((w << 6) + __builtin_ctzll(word)) * objectWordsCount);
+            word &= word - 1;
+
+            extentSize = 0;
+            for (int o = 0; o < objectWordsCount; o++) {
+                extent[o] &= attributeObjects[o];
+                extentSize += __builtin_popcountll(extent[o]);
+            }
+        }
+    }
+
+    std::fill(closure.begin(), closure.end(), ~0ULL);
+    if (contextAttributesCount % 64 != 0) {
+        closure.back() = (1ULL << (contextAttributesCount % 64)) - 1;
+    }
+
+    if (extentSize == 0) {
+        return;
+    }
+
+    if ((size_t)extentSize * attributeWordsCount < (size_t)contextAttributesCount * objectWordsCount) {
+        // Small extent, the rows of its objects are intersected
+        for (int o = 0; o < objectWordsCount; o++) {
+            uint64_t word = extent[o];
+
+            while (word != 0) {
+                const uint64_t* objectAttributes = objectBitsets.data() + ((size_t)((o << 6) + __builtin_ctzll(word)) * attributeWordsCount);
+                word &= word - 1;
+
+                for (int w = 0; w < attributeWordsCount; w++) {
+                    closure[w] &= objectAttributes[w];
+                }
+            }
+        }
+    }
+    else {
+        // Large extent, each attribute outside the set is tested against the extent
+        for (int attribute = 0; attribute < contextAttributesCount; attribute++) {
+            if (hasBit(set, attribute)) {
+                continue;
+            }
+
+            const uint64_t* attributeObjects = attributeBitsets.data() + ((size_t)attribute * objectWordsCount);
+
+            for (int o = 0; o < objectWordsCount; o++) {
+                if ((extent[o] & ~attributeObjects[o]) != 0) {
+                    clearBit(closure, attribute);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void addImplication(ImplicationIndex& index, ClosureState& state, const std::vector<uint64_t>& closure) {
+    int implication = index.premiseSizes.size();
+    int maxPremiseAttribute = -1;
+
+    for (int w = 0; w < index.wordsCount; w++) {
+        uint64_t word = state.set[w];
+
+        while (word != 0) {
+            int attribute = (w << 6) + __builtin_ctzll(word);
+            word &= word - 1;
+
+            index.attributeImplications[attribute].push_back(implication);
+            maxPremiseAttribute = attribute;
+        }
+
+        index.conclusions.push_back(closure[w] & ~state.set[w]);
+    }
+
+    index.premiseSizes.push_back(state.size);
+    index.maxPremiseAttributes.push_back(maxPremiseAttribute);
+    // The premise is the current set, all its attributes are already counted
+    index.counts.push_back(0);
+    index.candidateCounts.push_back(0);
+    index.countEpochs.push_back(0);
+
+    // The greatest attribute of the premise is not lower than the greatest premise attribute of any ready implication
+    state.readyImplications.push_back(implication);
+}
+
+#ifdef __EMSCRIPTEN__
+/**
+ * @returns Position of the set in the lectic order of all the subsets as a number from 0 to 1, estimated from the first attributes.
+ */
+double getLecticPosition(const std::vector<uint64_t>& set) {
+    double position = 0;
+    double weight = 0.5;
+
+    for (int attribute = 0; attribute < 52 && attribute < set.size() * 64; attribute++) {
+        if (hasBit(set, attribute)) {
+            position += weight;
+        }
+        weight /= 2;
+    }
+
+    return position;
+}
+#endif
+
+void duquenneGuiguesBasis(
+    TimedResult<std::vector<Implication>>& result,
+    std::vector<unsigned int>& contextMatrix,
+    int cellSize,
+    int cellsPerObject,
+    int contextObjectsCount,
+    int contextAttributesCount
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    TRACE_SCOPE("duquenneGuiguesBasis");
+
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    int objectWordsCount = (contextObjectsCount + 63) / 64;
+    int attributeWordsCount = (contextAttributesCount + 63) / 64;
+
+    std::vector<uint64_t> attributeBitsets = getAttributeBitsets(
+        contextMatrix,
+        cellSize,
+        cellsPerObject,
+        contextObjectsCount,
+        contextAttributesCount);
+    std::vector<uint64_t> objectBitsets((size_t)contextObjectsCount * attributeWordsCount, 0);
+
+    for (int object = 0; object < contextObjectsCount; object++) {
+        for (int attribute = 0; attribute < contextAttributesCount; attribute++) {
+            if (formalContextHasAttribute(contextMatrix, cellSize, cellsPerObject, object, attribute)) {
+                objectBitsets[((size_t)object * attributeWordsCount) + (attribute >> 6)] |= 1ULL << (attribute & 63);
+            }
+        }
+    }
+
+    ImplicationIndex index(contextAttributesCount);
+    ClosureState state(attributeWordsCount);
+    std::vector<uint64_t> extent(objectWordsCount);
+    std::vector<uint64_t> closure(attributeWordsCount);
+
+#ifdef __EMSCRIPTEN__
+    double lastProgress = 0;
+#endif
+
+    // The empty set is closed under no implications, every next set is closed under the implications found before it
+    do {
+        closeInContext(
+            state.set,
+            attributeBitsets,
+            objectBitsets,
+            contextObjectsCount,
+            contextAttributesCount,
+            extent,
+            closure);
+
+        if (closure != state.set) {
+            // The set is closed under the implications, but not in the context, so it is a pseudo-intent
+            addImplication(index, state, closure);
+
+            Implication& implication = result.value.emplace_back();
+            std::vector<int> premise = bitsetToVector(state.set);
+            std::vector<int> conclusion = bitsetToVector(std::vector<uint64_t>(
+                index.conclusions.end() - attributeWordsCount,
+                index.conclusions.end()));
+            implication.setPremise(premise);
+            implication.setConclusion(conclusion);
+        }
+
+#ifdef __EMSCRIPTEN__
+        if (!onProgress.isUndefined()) {
+            double progress = getLecticPosition(state.set);
+
+            if (progress - lastProgress >= 0.01) {
+                onProgress(progress);
+                lastProgress = progress;
+            }
+        }
+#endif
+    } while (nextClosure(index, state, contextAttributesCount));
+
+    long long endTime = nowMills();
+
+#ifdef __EMSCRIPTEN__
+    if (!onProgress.isUndefined()) {
+        onProgress(1);
+    }
+#endif
+
+    result.time = (int)endTime - startTime;
+    result.memory = memoryTracker.finish();
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef IMPLICATION_BASIS_H
+#define IMPLICATION_BASIS_H
+
+#include "types/Implication.h"
+#include "types/TimedResult.h"
+#include <vector>
+
+#ifdef __EMSCRIPTEN__
+#include "types/OnProgressCallback.h"
+#endif
+
+template struct TimedResult<std::vector<Implication>>;
+
+/**
+ * Computes the Duquenne-Guigues (canonical) basis of the implications of the context.
+ * The premises are the pseudo-intents, the conclusions contain only the attributes that are not in the premises.
+ * Implications are ordered lectically by their premises.
+ */
+void duquenneGuiguesBasis(
+    TimedResult<std::vector<Implication>>& result,
+    std::vector<unsigned int>& contextMatrix,
+    int cellSize,
+    int cellsPerObject,
+    int contextObjectsCount,
+    int contextAttributesCount
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+);
+
+#endif
\ No newline at end of file
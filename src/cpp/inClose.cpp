@@ -2,8 +2,12 @@
 // - https://www.researchgate.net/publication/228522038_In-Close_a_fast_algorithm_for_computing_formal_concepts
 
 #include "utils.h"
+#include "memory.h"
+#include "trace.h"
 #include "inClose.h"
+#include "compressedExtent.h"
 #include "types/FormalConcept.h"
+#include "types/CompressedFormalConcept.h"
 #include "types/TimedResult.h"
 
 #include <iostream>
@@ -11,15 +15,18 @@
 #include <queue>
 #include <vector>
 
+template <typename Concept>
 bool isCannonical(
     std::vector<unsigned int>& contextMatrix,
     int cellSize,
     int cellsPerObject,
-    FormalConcept& parentConcept,
+    Concept& parentConcept,
     std::vector<int>& newExtentBuffer,
     int newExtentSize,
     int startingAttribute
 ) {
+    TRACE_COUNTER("inClose.canonicityTests", 1);
+
     std::vector<int>& parentConceptAttributes = parentConcept.getAttributes();
 
     for (int k = parentConceptAttributes.size() - 1; k >= 0; k--) {
@@ -37,6 +44,7 @@ bool isCannonical(
                     break;
             }
             if (h == newExtentSize) {
+                TRACE_COUNTER("inClose.failedClosures", 1);
                 return false;
             }
         }
@@ -57,6 +65,7 @@ bool isCannonical(
                 break;
         }
         if (h == newExtentSize) {
+            TRACE_COUNTER("inClose.failedClosures", 1);
             return false;
         }
     }
@@ -64,14 +73,76 @@ bool isCannonical(
     return true;
 }
 
+/**
+ * Extents stored as vectors of objects, the objects of the parent extent are tested in the rows of the context matrix.
+ */
+struct PlainExtents {
+    typedef FormalConcept Concept;
+
+    std::vector<unsigned int>& contextMatrix;
+    int cellSize;
+    int cellsPerObject;
+
+    /**
+     * Takes those objects from the parent concept that have the attribute, i.e. generates a new potential extent.
+     * @returns Count of the objects written to the buffer.
+     */
+    int generateChildExtent(FormalConcept& parentConcept, int attribute, std::vector<int>& newExtentBuffer) const {
+        int lastObjectIndex = 0;
+        std::vector<int>& parentConceptObjects = parentConcept.getObjects();
+
+        for (int i = 0; i < parentConceptObjects.size(); i++) {
+            int object = parentConceptObjects[i];
+
+            if (formalContextHasAttribute(contextMatrix, cellSize, cellsPerObject, object, attribute)) {
+                newExtentBuffer[lastObjectIndex] = object;
+                lastObjectIndex++;
+            }
+        }
+
+        return lastObjectIndex;
+    }
+
+    void setConceptExtent(FormalConcept& concept, std::vector<int>& newExtentBuffer, int newExtentSize) const {
+        std::vector<int> newExtent(newExtentBuffer.begin(), newExtentBuffer.begin() + newExtentSize);
+        concept.setObjects(newExtent);
+    }
+};
+
+/**
+ * Compressed extents (see compressedExtent.h), the extent of the parent concept is intersected with the bitset
+ * of the objects that have the attribute. Dense and run containers are intersected a word at a time instead of testing each object.
+ */
+struct CompressedExtents {
+    typedef CompressedFormalConcept Concept;
+
+    /// @brief Bitsets of the objects of each attribute, see getAttributeBitsets().
+    std::vector<uint64_t> attributeBitsets;
+    size_t wordsCount;
+
+    int generateChildExtent(CompressedFormalConcept& parentConcept, int attribute, std::vector<int>& newExtentBuffer) const {
+        return parentConcept.getObjects().intersect(
+            attributeBitsets.data() + (attribute * wordsCount),
+            wordsCount,
+            newExtentBuffer.data());
+    }
+
+    void setConceptExtent(CompressedFormalConcept& concept, std::vector<int>& newExtentBuffer, int newExtentSize) const {
+        concept.setObjects(CompressedExtent(newExtentBuffer.data(), newExtentSize));
+    }
+};
+
+/// @param extents Generates and stores the extents of the concepts, see PlainExtents and CompressedExtents.
+template <typename Extents>
 void inCloseImpl(
     std::vector<unsigned int>& contextMatrix,
     int cellSize,
     int cellsPerObject,
     int contextObjectsCount,
     int contextAttributesCount,
+    const Extents& extents,
     std::vector<int>& newExtentBuffer,
-    std::vector<FormalConcept>& formalConcepts,
+    std::vector<typename Extents::Concept>& formalConcepts,
     int parentConceptIndex,
     int currentAttribute
 #ifdef __EMSCRIPTEN__
@@ -82,21 +153,10 @@ void inCloseImpl(
     std::queue<int> conceptsQueue;
 
     for (int j = currentAttribute; j < contextAttributesCount; j++) {
-        int lastObjectIndex = 0;
-        std::vector<int>& parentConceptObjects = formalConcepts[parentConceptIndex].getObjects();
-
-        // Take those objects from the parentConcept that have attribute j, i.e. generate a new potential extent
-        for (int i = 0; i < parentConceptObjects.size(); i++) {
-            int object = parentConceptObjects[i];
-
-            if (formalContextHasAttribute(contextMatrix, cellSize, cellsPerObject, object, j)) {
-                newExtentBuffer[lastObjectIndex] = object;
-                lastObjectIndex++;
-            }
-        }
+        int lastObjectIndex = extents.generateChildExtent(formalConcepts[parentConceptIndex], j, newExtentBuffer);
 
         if (lastObjectIndex > 0) {
-            if (lastObjectIndex == parentConceptObjects.size()) {
+            if (lastObjectIndex == formalConcepts[parentConceptIndex].getObjects().size()) {
                 std::vector<int>& attributes = formalConcepts[parentConceptIndex].getAttributes();
                 attributes.push_back(j);
             }
@@ -110,14 +170,13 @@ void inCloseImpl(
                 j - 1
             )) {
                 formalConcepts.emplace_back();
-                FormalConcept& newConcept = formalConcepts.back();
+                typename Extents::Concept& newConcept = formalConcepts.back();
 
                 std::vector<int> newIntent = formalConcepts[parentConceptIndex].getAttributesCopy();
                 newIntent.push_back(j);
                 newConcept.setAttributes(newIntent);
 
-                std::vector<int> newExtent(newExtentBuffer.begin(), newExtentBuffer.begin() + lastObjectIndex);
-                newConcept.setObjects(newExtent);
+                extents.setConceptExtent(newConcept, newExtentBuffer, lastObjectIndex);
 
                 newConcept.setAttribute(j);
 
@@ -140,6 +199,7 @@ void inCloseImpl(
             cellsPerObject,
             contextObjectsCount,
             contextAttributesCount,
+            extents,
             newExtentBuffer,
             formalConcepts,
             conceptIndex,
@@ -161,32 +221,28 @@ void inCloseImpl(
     }
 }
 
-void inClose(
-    TimedResult<std::vector<FormalConcept>>& result,
+template <typename Extents>
+void computeConceptsByInClose(
+    TimedResult<std::vector<typename Extents::Concept>>& result,
     std::vector<unsigned int>& contextMatrix,
     int cellSize,
     int cellsPerObject,
     int contextObjectsCount,
-    int contextAttributesCount
+    int contextAttributesCount,
+    const Extents& extents
 #ifdef __EMSCRIPTEN__
-    , OnProgressCallback onProgress
+    , OnProgressCallback& onProgress
 #endif
 ) {
-    //printFormalContext(contextMatrix, cellSize, cellsPerObject, contextObjectsCount, contextAttributesCount);
-
-    long long startTime = nowMills();
-
     std::vector<int> newExtentBuffer;
     newExtentBuffer.resize(contextObjectsCount);
 
-    std::vector<int> initialConceptObjects;
-    initialConceptObjects.reserve(contextObjectsCount);
     for (int i = 0; i < contextObjectsCount; i++) {
-        initialConceptObjects.push_back(i);
+        newExtentBuffer[i] = i;
     }
 
-    FormalConcept initialConcept = FormalConcept();
-    initialConcept.setObjects(initialConceptObjects);
+    typename Extents::Concept initialConcept;
+    extents.setConceptExtent(initialConcept, newExtentBuffer, contextObjectsCount);
     initialConcept.setAttribute(0);
 
     result.value.push_back(initialConcept);
@@ -197,6 +253,7 @@ void inClose(
         cellsPerObject,
         contextObjectsCount,
         contextAttributesCount,
+        extents,
         newExtentBuffer,
         result.value,
         0,
@@ -220,12 +277,45 @@ void inClose(
             conceptAttributes[i] = i;
         }
 
-        FormalConcept allAttributesConcept = FormalConcept();
+        typename Extents::Concept allAttributesConcept;
         allAttributesConcept.setAttributes(conceptAttributes);
         allAttributesConcept.setAttribute(0);
 
         result.value.push_back(allAttributesConcept);
     }
+}
+
+void inClose(
+    TimedResult<std::vector<FormalConcept>>& result,
+    std::vector<unsigned int>& contextMatrix,
+    int cellSize,
+    int cellsPerObject,
+    int contextObjectsCount,
+    int contextAttributesCount
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    //printFormalContext(contextMatrix, cellSize, cellsPerObject, contextObjectsCount, contextAttributesCount);
+    TRACE_SCOPE("inClose");
+
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    PlainExtents extents{ contextMatrix, cellSize, cellsPerObject };
+
+    computeConceptsByInClose(
+        result,
+        contextMatrix,
+        cellSize,
+        cellsPerObject,
+        contextObjectsCount,
+        contextAttributesCount,
+        extents
+#ifdef __EMSCRIPTEN__
+        , onProgress
+#endif
+    );
 
     long long endTime = nowMills();
 
@@ -236,4 +326,51 @@ void inClose(
 #endif
 
     result.time = (int)endTime - startTime;
+    result.memory = memoryTracker.finish();
 }
+
+void inCloseCompressed(
+    TimedResult<std::vector<CompressedFormalConcept>>& result,
+    std::vector<unsigned int>& contextMatrix,
+    int cellSize,
+    int cellsPerObject,
+    int contextObjectsCount,
+    int contextAttributesCount
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    TRACE_SCOPE("inCloseCompressed");
+
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    CompressedExtents extents{
+        getAttributeBitsets(contextMatrix, cellSize, cellsPerObject, contextObjectsCount, contextAttributesCount),
+        (size_t)(contextObjectsCount + 63) / 64
+    };
+
+    computeConceptsByInClose(
+        result,
+        contextMatrix,
+        cellSize,
+        cellsPerObject,
+        contextObjectsCount,
+        contextAttributesCount,
+        extents
+#ifdef __EMSCRIPTEN__
+        , onProgress
+#endif
+    );
+
+    long long endTime = nowMills();
+
+#ifdef __EMSCRIPTEN__
+    if (!onProgress.isUndefined()) {
+        onProgress(1);
+    }
+#endif
+
+    result.time = (int)endTime - startTime;
+    result.memory = memoryTracker.finish();
+}
\ No newline at end of file
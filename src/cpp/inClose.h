@@ -2,6 +2,7 @@
 #define INCLOSE_H
 
 #include "types/FormalConcept.h"
+#include "types/CompressedFormalConcept.h"
 #include "types/TimedResult.h"
 #include <vector>
 
@@ -10,6 +11,7 @@
 #endif
 
 template struct TimedResult<std::vector<FormalConcept>>;
+template struct TimedResult<std::vector<CompressedFormalConcept>>;
 
 void inClose(
     TimedResult<std::vector<FormalConcept>>& result,
@@ -23,4 +25,20 @@ void inClose(
 #endif
 );
 
+/**
+ * InClose that stores the extents of the concepts compressed (see compressedExtent.h).
+ * It needs considerably less memory for contexts with many objects, where the extents are large.
+ */
+void inCloseCompressed(
+    TimedResult<std::vector<CompressedFormalConcept>>& result,
+    std::vector<unsigned int>& contextMatrix,
+    int cellSize,
+    int cellsPerObject,
+    int contextObjectsCount,
+    int contextAttributesCount
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+);
+
 #endif
\ No newline at end of file
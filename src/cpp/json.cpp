@@ -0,0 +1,492 @@
+#include "types/ParsedContext.h"
+#include "contextParsing.h"
+#include "json.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <climits>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+// Nesting of skipped values deeper than this is considered invalid, so that the recursion cannot overflow the stack
+#define JSON_MAX_DEPTH 512
+
+/// @brief Names of a formal context as they are read from the file.
+struct JsonNames {
+    std::vector<std::string> values;
+    bool isArray = false;
+    bool allStrings = true;
+};
+
+/// @brief Forward-only reader of a JSON document that does not build a document tree.
+class JsonReader {
+public:
+    JsonReader(std::string_view content) : content(content), position(0) {}
+
+    /// @brief Returns the next non-whitespace character without consuming it, or '\0' at the end.
+    char peek() {
+        skipWhitespace();
+        return position < content.size() ? content[position] : '\0';
+    }
+
+    bool tryConsume(char character) {
+        if (peek() == character) {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char character) {
+        if (!tryConsume(character)) {
+            fail();
+        }
+    }
+
+    bool isAtEnd() {
+        skipWhitespace();
+        return position >= content.size();
+    }
+
+    /// @brief Calls onElement for each element of an array, onElement has to read the whole element.
+    template <typename F>
+    void readArray(F onElement) {
+        expect('[');
+
+        if (tryConsume(']')) {
+            return;
+        }
+
+        do {
+            onElement();
+        } while (tryConsume(','));
+
+        expect(']');
+    }
+
+    /// @brief Calls onMember with the key of each member of an object, onMember has to read the whole value.
+    template <typename F>
+    void readObject(F onMember) {
+        expect('{');
+
+        if (tryConsume('}')) {
+            return;
+        }
+
+        do {
+            if (peek() != '"') {
+                fail();
+            }
+
+            std::string key = readString();
+            expect(':');
+            onMember(key);
+        } while (tryConsume(','));
+
+        expect('}');
+    }
+
+    std::string readString() {
+        expect('"');
+        std::string value;
+
+        while (true) {
+            size_t start = position;
+
+            // Characters without escapes are copied in larger blocks
+            while (position < content.size() && content[position] != '"' && content[position] != '\\' && (unsigned char)content[position] >= 0x20) {
+                position++;
+            }
+
+            value.append(content.substr(start, position - start));
+
+            if (position >= content.size() || (unsigned char)content[position] < 0x20) {
+                fail();
+            }
+            if (content[position++] == '"') {
+                return value;
+            }
+
+            readEscape(value);
+        }
+    }
+
+    /// @brief Reads a number, integers are read without the conversion of the whole token.
+    /// @return Whether the number is a non-negative integer that fits into int.
+    bool readIndex(int& index) {
+        skipWhitespace();
+        size_t start = position;
+        bool negative = position < content.size() && content[position] == '-';
+
+        if (negative) {
+            position++;
+        }
+
+        size_t digitsStart = position;
+        long long value = 0;
+
+        while (position < content.size() && isDigit(content[position])) {
+            value = std::min((value * 10) + (content[position] - '0'), (long long)INT_MAX + 1);
+            position++;
+        }
+
+        if (position == digitsStart || (content[digitsStart] == '0' && position - digitsStart > 1)) {
+            fail();
+        }
+
+        if (position < content.size() && (content[position] == '.' || content[position] == 'e' || content[position] == 'E')) {
+            // Numbers like 1.0 or 1e2 are integers as well
+            skipNumberRest();
+            double number = std::strtod(std::string(content.substr(start, position - start)).c_str(), nullptr);
+
+            if (!(number >= 0 && number <= INT_MAX && number == std::floor(number))) {
+                return false;
+            }
+
+            index = (int)number;
+            return true;
+        }
+
+        if ((negative && value != 0) || value > INT_MAX) {
+            return false;
+        }
+
+        index = (int)value;
+        return true;
+    }
+
+    void skipValue(int depth = 0) {
+        if (depth > JSON_MAX_DEPTH) {
+            fail();
+        }
+
+        switch (peek()) {
+            case '{':
+                readObject([&](const std::string&) { skipValue(depth + 1); });
+                break;
+            case '[':
+                readArray([&]() { skipValue(depth + 1); });
+                break;
+            case '"':
+                readString();
+                break;
+            case 't':
+                expectLiteral("true");
+                break;
+            case 'f':
+                expectLiteral("false");
+                break;
+            case 'n':
+                expectLiteral("null");
+                break;
+            default:
+                int index;
+                readIndex(index);
+                break;
+        }
+    }
+
+    [[noreturn]] void fail() {
+        throw std::invalid_argument("The file is not a valid JSON document.");
+    }
+
+private:
+    std::string_view content;
+    size_t position;
+
+    static bool isDigit(char character) {
+        return character >= '0' && character <= '9';
+    }
+
+    void skipWhitespace() {
+        while (position < content.size() &&
+            (content[position] == ' ' || content[position] == '\n' || content[position] == '\r' || content[position] == '\t')) {
+            position++;
+        }
+    }
+
+    void skipNumberRest() {
+        if (position < content.size() && content[position] == '.') {
+            position++;
+            size_t digitsStart = position;
+
+            while (position < content.size() && isDigit(content[position])) {
+                position++;
+            }
+            if (position == digitsStart) {
+                fail();
+            }
+        }
+
+        if (position < content.size() && (content[position] == 'e' || content[position] == 'E')) {
+            position++;
+
+            if (position < content.size() && (content[position] == '+' || content[position] == '-')) {
+                position++;
+            }
+
+            size_t digitsStart = position;
+
+            while (position < content.size() && isDigit(content[position])) {
+                position++;
+            }
+            if (position == digitsStart) {
+                fail();
+            }
+        }
+    }
+
+    void expectLiteral(std::string_view literal) {
+        if (content.substr(position, literal.size()) != literal) {
+            fail();
+        }
+        position += literal.size();
+    }
+
+    unsigned int readHexCodeUnit() {
+        if (position + 4 > content.size()) {
+            fail();
+        }
+
+        unsigned int codeUnit = 0;
+
+        for (int i = 0; i < 4; i++) {
+            char character = content[position++];
+            codeUnit <<= 4;
+
+            if (isDigit(character)) {
+                codeUnit |= character - '0';
+            }
+            else if (character >= 'a' && character <= 'f') {
+                codeUnit |= character - 'a' + 10;
+            }
+            else if (character >= 'A' && character <= 'F') {
+                codeUnit |= character - 'A' + 10;
+            }
+            else {
+                fail();
+            }
+        }
+
+        return codeUnit;
+    }
+
+    void readEscape(std::string& value) {
+        if (position >= content.size()) {
+            fail();
+        }
+
+        switch (content[position++]) {
+            case '"': value.push_back('"'); break;
+            case '\\': value.push_back('\\'); break;
+            case '/': value.push_back('/'); break;
+            case 'b': value.push_back('\b'); break;
+            case 'f': value.push_back('\f'); break;
+            case 'n': value.push_back('\n'); break;
+            case 'r': value.push_back('\r'); break;
+            case 't': value.push_back('\t'); break;
+            case 'u': appendCodePoint(value, readCodePoint()); break;
+            default: fail();
+        }
+    }
+
+    unsigned int readCodePoint() {
+        unsigned int codeUnit = readHexCodeUnit();
+
+        if (codeUnit >= 0xD800 && codeUnit <= 0xDBFF && content.substr(position, 2) == "\\u") {
+            size_t lowStart = position;
+            position += 2;
+            unsigned int lowCodeUnit = readHexCodeUnit();
+
+            if (lowCodeUnit >= 0xDC00 && lowCodeUnit <= 0xDFFF) {
+                return 0x10000 + ((codeUnit - 0xD800) << 10) + (lowCodeUnit - 0xDC00);
+            }
+
+            position = lowStart;
+        }
+
+        // Lone surrogates cannot be represented in UTF-8
+        return codeUnit >= 0xD800 && codeUnit <= 0xDFFF ? 0xFFFD : codeUnit;
+    }
+
+    static void appendCodePoint(std::string& value, unsigned int codePoint) {
+        if (codePoint < 0x80) {
+            value.push_back((char)codePoint);
+        }
+        else if (codePoint < 0x800) {
+            value.push_back((char)(0xC0 | (codePoint >> 6)));
+            value.push_back((char)(0x80 | (codePoint & 0x3F)));
+        }
+        else if (codePoint < 0x10000) {
+            value.push_back((char)(0xE0 | (codePoint >> 12)));
+            value.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+            value.push_back((char)(0x80 | (codePoint & 0x3F)));
+        }
+        else {
+            value.push_back((char)(0xF0 | (codePoint >> 18)));
+            value.push_back((char)(0x80 | ((codePoint >> 12) & 0x3F)));
+            value.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+            value.push_back((char)(0x80 | (codePoint & 0x3F)));
+        }
+    }
+};
+
+void readJsonNames(JsonReader& reader, JsonNames& names) {
+    names = JsonNames();
+
+    if (reader.peek() != '[') {
+        reader.skipValue();
+        return;
+    }
+
+    names.isArray = true;
+
+    reader.readArray([&]() {
+        if (reader.peek() == '"') {
+            names.values.push_back(reader.readString());
+        }
+        else {
+            names.allStrings = false;
+            reader.skipValue();
+        }
+    });
+}
+
+/// @brief Reads the [object, attribute] pairs of a relation.
+/// @return Whether all the pairs consist of two indexes.
+bool readJsonRelation(JsonReader& reader, std::vector<std::pair<int, int>>& relation) {
+    bool valid = true;
+
+    reader.readArray([&]() {
+        if (reader.peek() != '[') {
+            valid = false;
+            reader.skipValue();
+            return;
+        }
+
+        int indexes[2] = { -1, -1 };
+        int count = 0;
+
+        reader.readArray([&]() {
+            char next = reader.peek();
+
+            if (next == '-' || (next >= '0' && next <= '9')) {
+                int index;
+                bool isIndex = reader.readIndex(index);
+
+                if (count < 2) {
+                    indexes[count] = isIndex ? index : -1;
+                }
+            }
+            else {
+                valid = false;
+                reader.skipValue();
+            }
+
+            count++;
+        });
+
+        valid &= count == 2;
+        relation.push_back({ indexes[0], indexes[1] });
+    });
+
+    return valid;
+}
+
+void validateJsonNames(const JsonNames& names, const std::string& missingMessage, const std::string& invalidMessage) {
+    if (!names.isArray || (names.values.empty() && names.allStrings)) {
+        throw std::invalid_argument(missingMessage);
+    }
+    if (!names.allStrings) {
+        throw std::invalid_argument(invalidMessage);
+    }
+}
+
+void parseJson(ParsedContext& result, std::string_view fileContent) {
+    JsonReader reader(fileContent);
+    JsonNames objects;
+    JsonNames attributes;
+    std::vector<std::pair<int, int>> relation;
+    bool hasObjects = false;
+    bool hasAttributes = false;
+    bool hasRelation = false;
+    bool hasConcepts = false;
+    bool isRelationArray = false;
+    bool isRelationValid = true;
+
+    if (reader.peek() != '{') {
+        reader.fail();
+    }
+
+    reader.readObject([&](const std::string& key) {
+        if (key == "name") {
+            result.hasName = reader.peek() == '"';
+
+            if (result.hasName) {
+                result.name = reader.readString();
+            }
+            else {
+                reader.skipValue();
+            }
+        }
+        else if (key == "objects") {
+            hasObjects = true;
+            readJsonNames(reader, objects);
+        }
+        else if (key == "attributes") {
+            hasAttributes = true;
+            readJsonNames(reader, attributes);
+        }
+        else if (key == "relation") {
+            hasRelation = true;
+            isRelationArray = reader.peek() == '[';
+            relation.clear();
+
+            if (isRelationArray) {
+                isRelationValid = readJsonRelation(reader, relation);
+            }
+            else {
+                reader.skipValue();
+            }
+        }
+        else {
+            hasConcepts |= key == "concepts";
+            reader.skipValue();
+        }
+    });
+
+    if (!reader.isAtEnd()) {
+        reader.fail();
+    }
+
+    if (!hasObjects || !hasAttributes || !(hasRelation || hasConcepts)) {
+        throw std::invalid_argument("The file does not contain a formal context.");
+    }
+    if (!hasRelation) {
+        // Files with concepts are parsed together with the concepts and the lattice
+        result.hasConcepts = true;
+        return;
+    }
+
+    validateJsonNames(objects, "Objects are missing.", "Not all objects are strings.");
+    validateJsonNames(attributes, "Attributes are missing.", "Not all attributes are strings.");
+
+    int objectsCount = objects.values.size();
+    int attributesCount = attributes.values.size();
+
+    if (!isRelationValid) {
+        throw std::invalid_argument("Invalid relation format.");
+    }
+
+    for (auto [object, attribute] : relation) {
+        if (object < 0 || object >= objectsCount || attribute < 0 || attribute >= attributesCount) {
+            throw std::invalid_argument("Invalid relation format.");
+        }
+    }
+
+    result.context = createFormalContext(std::move(objects.values), std::move(attributes.values), relation);
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include "types/ParsedContext.h"
+#include <string_view>
+
+/**
+ * Parses a JSON file with the objects, attributes and relation of a formal context in a single pass.
+ * The relation is read as [object, attribute] pairs directly, without building a document tree.
+ *
+ * If the file stores concepts instead of a relation, only result.hasConcepts is set.
+ *
+ * @throws std::invalid_argument if the file is not valid JSON or does not describe a formal context.
+ */
+void parseJson(ParsedContext& result, std::string_view fileContent);
+
+#endif
\ No newline at end of file
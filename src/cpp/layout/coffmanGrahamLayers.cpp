@@ -0,0 +1,155 @@
+// Implementation of E. G. Coffman and R. L. Graham, "Optimal scheduling for two-processor systems"
+// as described in P. Healy and N. S. Nikolov, "Hierarchical Drawing Algorithms" (Handbook of Graph Drawing and Visualization)
+
+#include "layers.h"
+
+#include <vector>
+#include <memory>
+#include <unordered_set>
+#include <queue>
+#include <algorithm>
+#include <functional>
+
+void assignCoffmanGrahamLabels(
+    CompactMapping& subconcepts,
+    CompactMapping& superconcepts,
+    std::vector<int>& labels
+) {
+    // A node can be labeled once all its superconcepts are labeled.
+    // The node whose decreasingly sorted labels of superconcepts are lexicographically smallest is labeled first.
+    int nodesCount = labels.size();
+    std::vector<int> unlabeledSuperconceptsCounts(nodesCount);
+    // Labels of the superconcepts of each node, stored at the same offsets as the superconcepts
+    std::vector<int> superconceptsLabels(superconcepts.nodes.size());
+    std::vector<int> filledLabelsCounts(nodesCount, 0);
+
+    auto isGreater = [&](int first, int second) {
+        int firstStart = superconcepts.offsets[first];
+        int firstEnd = superconcepts.offsets[first + 1];
+        int secondStart = superconcepts.offsets[second];
+        int secondEnd = superconcepts.offsets[second + 1];
+
+        bool isLess = std::lexicographical_compare(
+            superconceptsLabels.begin() + secondStart,
+            superconceptsLabels.begin() + secondEnd,
+            superconceptsLabels.begin() + firstStart,
+            superconceptsLabels.begin() + firstEnd);
+        bool isEqual = !isLess && (firstEnd - firstStart) == (secondEnd - secondStart) && std::equal(
+            superconceptsLabels.begin() + firstStart,
+            superconceptsLabels.begin() + firstEnd,
+            superconceptsLabels.begin() + secondStart);
+
+        // Ties are broken by the node index to keep the result deterministic
+        return isLess || (isEqual && second < first);
+    };
+
+    std::priority_queue<int, std::vector<int>, decltype(isGreater)> readyNodes(isGreater);
+
+    for (int node = 0; node < nodesCount; node++) {
+        unlabeledSuperconceptsCounts[node] = superconcepts.offsets[node + 1] - superconcepts.offsets[node];
+
+        if (unlabeledSuperconceptsCounts[node] == 0) {
+            readyNodes.push(node);
+        }
+    }
+
+    int nextLabel = 0;
+
+    while (!readyNodes.empty()) {
+        int node = readyNodes.top();
+        readyNodes.pop();
+
+        labels[node] = nextLabel;
+        nextLabel++;
+
+        for (int i = subconcepts.offsets[node]; i < subconcepts.offsets[node + 1]; i++) {
+            int subconcept = subconcepts.nodes[i];
+            int start = superconcepts.offsets[subconcept];
+
+            superconceptsLabels[start + filledLabelsCounts[subconcept]] = labels[node];
+            filledLabelsCounts[subconcept]++;
+            unlabeledSuperconceptsCounts[subconcept]--;
+
+            if (unlabeledSuperconceptsCounts[subconcept] == 0) {
+                std::sort(
+                    superconceptsLabels.begin() + start,
+                    superconceptsLabels.begin() + superconcepts.offsets[subconcept + 1],
+                    std::greater<int>());
+                readyNodes.push(subconcept);
+            }
+        }
+    }
+}
+
+std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> assignNodesToLayersByCoffmanGraham(
+    int startConceptIndex,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    int maxLayerWidth
+) {
+    int nodesCount = subconceptsMapping.size();
+    auto subconcepts = createCompactMapping(subconceptsMapping);
+    auto superconcepts = createCompactMapping(superconceptsMapping);
+
+    if (maxLayerWidth <= 0) {
+        // Average width of the layers when the height is minimal
+        auto longestPathLayers = computeLongestPathLayers(startConceptIndex, subconcepts);
+        int layersCount = std::max(*std::max_element(longestPathLayers.begin(), longestPathLayers.end()) + 1, 1);
+        maxLayerWidth = (nodesCount + layersCount - 1) / layersCount;
+    }
+
+    std::vector<int> labels(nodesCount);
+    assignCoffmanGrahamLabels(subconcepts, superconcepts, labels);
+
+    // Layers are filled from the bottom, the node with the highest label goes first.
+    // A node can be placed once all its subconcepts are placed in lower layers.
+    std::vector<int> bottomLayersMapping(nodesCount, -1);
+    std::vector<int> unplacedSubconceptsCounts(nodesCount);
+    std::vector<int> highestSubconceptLayers(nodesCount, -1);
+    std::priority_queue<std::pair<int, int>> readyNodes;
+
+    for (int node = 0; node < nodesCount; node++) {
+        unplacedSubconceptsCounts[node] = subconcepts.offsets[node + 1] - subconcepts.offsets[node];
+
+        if (unplacedSubconceptsCounts[node] == 0) {
+            readyNodes.push({ labels[node], node });
+        }
+    }
+
+    int currentLayer = 0;
+    int currentLayerWidth = 0;
+
+    while (!readyNodes.empty()) {
+        int node = readyNodes.top().second;
+        readyNodes.pop();
+
+        if (currentLayerWidth >= maxLayerWidth || highestSubconceptLayers[node] >= currentLayer) {
+            currentLayer++;
+            currentLayerWidth = 0;
+        }
+
+        bottomLayersMapping[node] = currentLayer;
+        currentLayerWidth++;
+
+        for (int i = superconcepts.offsets[node]; i < superconcepts.offsets[node + 1]; i++) {
+            int superconcept = superconcepts.nodes[i];
+
+            highestSubconceptLayers[superconcept] = std::max(highestSubconceptLayers[superconcept], currentLayer);
+            unplacedSubconceptsCounts[superconcept]--;
+
+            if (unplacedSubconceptsCounts[superconcept] == 0) {
+                readyNodes.push({ labels[superconcept], superconcept });
+            }
+        }
+    }
+
+    // Layers are ordered from top to bottom – the start concept is the only node in the top layer
+    std::vector<int> layersMapping(nodesCount);
+    int topLayer = bottomLayersMapping[startConceptIndex];
+
+    for (int node = 0; node < nodesCount; node++) {
+        layersMapping[node] = topLayer - bottomLayersMapping[node];
+    }
+
+    return createLayersFromMapping(std::move(layersMapping));
+}
@@ -0,0 +1,53 @@
+#include "../utils.h"
+#include "convergence.h"
+
+#include <cmath>
+#include <string>
+
+ConvergenceTracker::ConvergenceTracker(ConvergenceCriteria criteria, long long startTime) :
+    criteria(criteria),
+    startTime(startTime),
+    previousTotal(-1),
+    iterationsCount(0),
+    stopReason(STOP_REASON_ITERATIONS) {}
+
+void ConvergenceTracker::beginLoop() {
+    previousTotal = -1;
+}
+
+bool ConvergenceTracker::canContinue() {
+    if (stopReason == STOP_REASON_TIME) {
+        return false;
+    }
+
+    if (criteria.timeBudget > 0 && nowMills() - startTime >= criteria.timeBudget) {
+        stopReason = STOP_REASON_TIME;
+        return false;
+    }
+
+    return true;
+}
+
+bool ConvergenceTracker::step(Displacement displacement, float totalEpsilon) {
+    iterationsCount++;
+
+    if ((criteria.maxDisplacement > 0 && displacement.max < criteria.maxDisplacement) || displacement.total < totalEpsilon) {
+        stopReason = STOP_REASON_DISPLACEMENT;
+        return true;
+    }
+
+    if (criteria.energyDelta > 0 && previousTotal > 0) {
+        float delta = std::abs(previousTotal - displacement.total) / previousTotal;
+
+        if (delta < criteria.energyDelta) {
+            previousTotal = displacement.total;
+            stopReason = STOP_REASON_ENERGY;
+            return true;
+        }
+    }
+
+    previousTotal = displacement.total;
+    stopReason = STOP_REASON_ITERATIONS;
+
+    return false;
+}
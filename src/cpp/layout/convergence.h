@@ -0,0 +1,48 @@
+#ifndef CONVERGENCE_H
+#define CONVERGENCE_H
+
+#include "../types/ConvergenceCriteria.h"
+#include <string>
+
+#define STOP_REASON_ITERATIONS "iterations"
+#define STOP_REASON_DISPLACEMENT "displacement"
+#define STOP_REASON_ENERGY "energy"
+#define STOP_REASON_TIME "time"
+
+/// @brief Displacement of the nodes caused by a single iteration of a layout.
+struct Displacement {
+    float total;
+    float max;
+};
+
+/**
+ * Decides when an iterative layout can stop.
+ * 
+ * A layout can consist of several loops (phases). Displacement and energy criteria are evaluated per loop,
+ * the time budget and the iterations count are shared by all loops.
+ */
+class ConvergenceTracker {
+public:
+    ConvergenceTracker(ConvergenceCriteria criteria, long long startTime);
+
+    void beginLoop();
+    /// @brief Returns false when the time budget is exhausted.
+    bool canContinue();
+    /// @brief Records a finished iteration. Returns true when the current loop has converged.
+    /// @param displacement
+    /// @param totalEpsilon The loop has also converged when the total displacement is smaller than this value.
+    /// @return
+    bool step(Displacement displacement, float totalEpsilon = 0);
+
+    int getIterationsCount() const { return iterationsCount; }
+    std::string getStopReason() const { return stopReason; }
+
+private:
+    ConvergenceCriteria criteria;
+    long long startTime;
+    float previousTotal;
+    int iterationsCount;
+    std::string stopReason;
+};
+
+#endif
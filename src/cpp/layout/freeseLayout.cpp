@@ -4,10 +4,15 @@
 // Based on the source code from: http://latdraw.org/
 
 #include "../utils.h"
-#include "../types/TimedResult.h"
+#include "../memory.h"
+#include "../trace.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
 #include "../types/ProgressData.h"
 #include "utils.h"
 #include "layers.h"
+#include "convergence.h"
+#include "warmStart.h"
 #include "freeseLayout.h"
 
 #define _USE_MATH_DEFINES
@@ -21,13 +26,16 @@
 #include <unordered_map>
 #include <queue>
 #include <algorithm>
+#include <numeric>
 #include <functional>
+#include <optional>
 
 #define PRIMES_COUNT 10
 #define CORRECTION_FACTOR 0.5
 #define ATTRACTION_CONSTANT 0.1
 #define REPULSION_CONSTANT 1
 #define ITERATIONS 30
+#define WARM_START_ITERATIONS 10
 
 const int PRIMES[PRIMES_COUNT] = { 3, 5, 7, 11, 13, 17, 19, 23, 29, 31 };
 int nextPrimeIndex = 0;
@@ -45,14 +53,14 @@ std::unique_ptr<std::tuple<std::vector<int>, std::unordered_map<int, int>>> assi
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping
 ) {
-    auto depthsResult = assignNodesToLayersByLongestPath(supremum, subconceptsMapping);
-    auto& [depthsMapping, depthLayers] = *depthsResult;
-    auto heightResult = assignNodesToLayersByLongestPath(infimum, superconceptsMapping);
-    auto& [heightsMapping, heightLayers] = *heightResult;
+    auto subconcepts = createCompactMapping(subconceptsMapping);
+    auto superconcepts = createCompactMapping(superconceptsMapping);
+    auto depthsMapping = computeLongestPathLayers(supremum, subconcepts);
+    auto heightsMapping = computeLongestPathLayers(infimum, superconcepts);
 
     auto result = std::make_unique<std::tuple<std::vector<int>, std::unordered_map<int, int>>>();
 
-    int maxDepth = depthLayers.size();
+    int maxDepth = *std::max_element(depthsMapping.begin(), depthsMapping.end()) + 1;
     auto& [ranksMapping, rankCounts] = *result;
     ranksMapping.resize(conceptsCount);
 
@@ -107,6 +115,27 @@ void initializeLayout(
     }
 }
 
+/**
+ * Moves the nodes to their positions in the previous layout. The vertical positions are given by the ranks and are kept.
+ */
+void seedLayout(
+    std::vector<float>& layout,
+    int conceptsCount,
+    const WarmStart& warmStart,
+    std::vector<int>& previousIndexes,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+) {
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        float x, y, z;
+
+        if (getWarmStartPosition(conceptIndex, warmStart, previousIndexes, subconceptsMapping, superconceptsMapping, x, y, z)) {
+            setX(layout, conceptIndex, x);
+            setZ(layout, conceptIndex, z);
+        }
+    }
+}
+
 /**
  * Moves nodes so their distances from the center are closer to the ideal distances.
  */
@@ -156,22 +185,28 @@ float forceCorrelation(ForcePoint& force) {
 
 /**
  * Applies current force to the node.
+ * 
+ * @return Distance the node has been moved by.
  */
-void applyForce(
+float applyForce(
     std::vector<float>& layout,
     std::vector<ForcePoint>& forces,
     int index
 ) {
     ForcePoint& force = forces[index];
     float correction = 1 + CORRECTION_FACTOR * forceCorrelation(force);
+    float dx = correction * force.newX;
+    float dz = correction * force.newZ;
 
-    setX(layout, index, getX(layout, index) + correction * force.newX);
-    setZ(layout, index, getZ(layout, index) + correction * force.newZ);
+    setX(layout, index, getX(layout, index) + dx);
+    setZ(layout, index, getZ(layout, index) + dz);
 
     force.oldX = force.newX;
     force.oldZ = force.newZ;
     force.newX = 0;
     force.newZ = 0;
+
+    return std::sqrt(dx * dx + dz * dz);
 }
 
 /**
@@ -195,18 +230,44 @@ void adjustForce(
     forces[index].newZ += dz;
 }
 
+/**
+ * Adjusts forces of both nodes of the pair.
+ * 
+ * If the pair is not symmetric, only the first node is adjusted, but twice,
+ * as if the pair was visited from the side of both nodes.
+ */
+void adjustPairForces(
+    std::vector<ForcePoint>& forces,
+    int first,
+    int second,
+    float dx,
+    float dz,
+    bool symmetric
+) {
+    adjustForce(forces, first, dx, dz);
+
+    if (symmetric) {
+        adjustForce(forces, second, -dx, -dz);
+    }
+    else {
+        adjustForce(forces, first, dx, dz);
+    }
+}
+
 void attraction(
     std::vector<ForcePoint>& forces,
     float attractionFactor,
     std::vector<float>& layout,
     int first,
-    int second
+    int second,
+    bool symmetric
 ) {
+    TRACE_COUNTER("freeseLayout.attractionEvaluations", 1);
+
     float dx = attractionFactor * (getX(layout, second) - getX(layout, first));
     float dz = attractionFactor * (getZ(layout, second) - getZ(layout, first));
 
-    adjustForce(forces, first, dx, dz);
-    adjustForce(forces, second, -dx, -dz);
+    adjustPairForces(forces, first, second, dx, dz, symmetric);
 }
 
 void repulsion(
@@ -214,8 +275,11 @@ void repulsion(
     float repulsionFactor,
     std::vector<float>& layout,
     int first,
-    int second
+    int second,
+    bool symmetric
 ) {
+    TRACE_COUNTER("freeseLayout.repulsionEvaluations", 1);
+
     float dx = getX(layout, first) - getX(layout, second);
     float dy = getY(layout, first) - getY(layout, second);
     float dz = getZ(layout, first) - getZ(layout, second);
@@ -227,24 +291,30 @@ void repulsion(
     dx *= denominator * repulsionFactor;
     dz *= denominator * repulsionFactor;
 
-    adjustForce(forces, first, dx, dz);
-    adjustForce(forces, second, -dx, -dz);
+    adjustPairForces(forces, first, second, dx, dz, symmetric);
 }
 
-void update(
+/**
+ * Moves the movable nodes. If only some of the nodes are movable,
+ * forces are computed only for pairs containing a movable node.
+ */
+Displacement update(
     std::vector<float>& layout,
     std::vector<ForcePoint>& forces,
     float attractionFactor,
     float repulsionFactor,
     int conceptsCount,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
-    std::vector<std::unordered_set<int>>& superconceptsMapping
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<int>& movableConcepts
 ) {
-    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+    bool symmetric = movableConcepts.size() == conceptsCount;
+
+    for (int conceptIndex : movableConcepts) {
         auto comparableConcepts = getComparableConcepts(conceptIndex, subconceptsMapping, superconceptsMapping);
 
         for (int comp : *comparableConcepts) {
-            attraction(forces, attractionFactor, layout, conceptIndex, comp);
+            attraction(forces, attractionFactor, layout, conceptIndex, comp, symmetric);
         }
 
         for (int incomp = 0; incomp < conceptsCount; incomp++) {
@@ -252,13 +322,20 @@ void update(
                 continue;
             }
 
-            repulsion(forces, repulsionFactor, layout, conceptIndex, incomp);
+            repulsion(forces, repulsionFactor, layout, conceptIndex, incomp, symmetric);
         }
     }
 
-    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
-        applyForce(layout, forces, conceptIndex);
+    Displacement displacement = { 0, 0 };
+
+    for (int conceptIndex : movableConcepts) {
+        float conceptDisplacement = applyForce(layout, forces, conceptIndex);
+
+        displacement.total += conceptDisplacement;
+        displacement.max = std::max(displacement.max, conceptDisplacement);
     }
+
+    return displacement;
 }
 
 void multiUpdate(
@@ -270,34 +347,84 @@ void multiUpdate(
     int conceptsCount,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<int>& movableConcepts,
+    ConvergenceTracker& convergence,
     ProgressData& progress
 ) {
+    TRACE_SCOPE("freeseLayout.multiUpdate");
+
     progress.beginBlock(updatesCount);
+    convergence.beginLoop();
 
-    for (int i = 0; i < updatesCount; i++) {
-        update(layout, forces, attractionFactor, repulsionFactor, conceptsCount, subconceptsMapping, superconceptsMapping);
+    for (int i = 0; i < updatesCount && convergence.canContinue(); i++) {
+        auto displacement = update(layout, forces, attractionFactor, repulsionFactor, conceptsCount, subconceptsMapping, superconceptsMapping, movableConcepts);
 
         progress.progress(i + 1);
+
+        if (convergence.step(displacement)) {
+            break;
+        }
     }
 
     progress.finishBlock();
 }
 
 void computeFreeseLayout(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
     std::function<void(double)> onProgress
 ) {
     long long startTime = nowMills();
-
-    auto progress = ProgressData(3, onProgress);
+    MemoryTracker memoryTracker;
 
     auto ranksResult = assignRanksToNodes(conceptsCount, supremum, infimum, subconceptsMapping, superconceptsMapping);
     auto& [ranksMapping, rankCounts] = *ranksResult;
+
+    computeFreeseLayout(
+        result,
+        supremum,
+        infimum,
+        conceptsCount,
+        subconceptsMapping,
+        superconceptsMapping,
+        ranksMapping,
+        rankCounts,
+        convergenceCriteria,
+        warmStart,
+        onProgress);
+
+    long long endTime = nowMills();
+
+    result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+}
+
+void computeFreeseLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<int>& ranksMapping,
+    std::unordered_map<int, int>& rankCounts,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
+    std::function<void(double)> onProgress
+) {
+    TRACE_SCOPE("freeseLayout");
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    auto progress = ProgressData(3, onProgress);
+    auto convergence = ConvergenceTracker(convergenceCriteria, startTime);
+
     auto forces = std::make_unique<std::vector<ForcePoint>>();
 
     forces->resize(conceptsCount);
@@ -305,11 +432,30 @@ void computeFreeseLayout(
     float attractionFactor = ATTRACTION_CONSTANT / std::sqrt(conceptsCount);
     float repulsionFactor = REPULSION_CONSTANT / std::sqrt(conceptsCount);
 
-    int singleIterationUpdatesCount = ITERATIONS + conceptsCount;
-    int totalUpdatesCount = 3 * singleIterationUpdatesCount;
-
     initializeLayout(result.value, conceptsCount, ranksMapping, rankCounts);
 
+    std::vector<int> movableConcepts;
+
+    if (warmStart) {
+        // Only the region affected by the changes of the lattice is relaxed, the rest stays where it was
+        auto previousIndexes = getPreviousIndexes(*warmStart, conceptsCount);
+        auto affectedConcepts = getAffectedConcepts(*warmStart, previousIndexes, subconceptsMapping, superconceptsMapping);
+
+        seedLayout(result.value, conceptsCount, *warmStart, previousIndexes, subconceptsMapping, superconceptsMapping);
+
+        for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+            if (affectedConcepts[conceptIndex]) {
+                movableConcepts.push_back(conceptIndex);
+            }
+        }
+    }
+    else {
+        movableConcepts.resize(conceptsCount);
+        std::iota(movableConcepts.begin(), movableConcepts.end(), 0);
+    }
+
+    int singleIterationUpdatesCount = (warmStart ? WARM_START_ITERATIONS : ITERATIONS) + movableConcepts.size();
+
     multiUpdate(
         singleIterationUpdatesCount,
         result.value,
@@ -319,6 +465,8 @@ void computeFreeseLayout(
         conceptsCount,
         subconceptsMapping,
         superconceptsMapping,
+        movableConcepts,
+        convergence,
         progress);
 
     multiUpdate(
@@ -330,6 +478,8 @@ void computeFreeseLayout(
         conceptsCount,
         subconceptsMapping,
         superconceptsMapping,
+        movableConcepts,
+        convergence,
         progress);
 
     multiUpdate(
@@ -341,6 +491,8 @@ void computeFreeseLayout(
         conceptsCount,
         subconceptsMapping,
         superconceptsMapping,
+        movableConcepts,
+        convergence,
         progress);
 
     normalizeDistances(result.value, conceptsCount, supremum, infimum, ranksMapping, rankCounts);
@@ -348,4 +500,7 @@ void computeFreeseLayout(
     long long endTime = nowMills();
 
     result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+    result.iterationsCount = convergence.getIterationsCount();
+    result.stopReason = convergence.getStopReason();
 }
\ No newline at end of file
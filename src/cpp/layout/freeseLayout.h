@@ -2,9 +2,14 @@
 #define FREESE_LAYOUT_H
 
 #include <vector>
+#include <memory>
 #include <unordered_set>
+#include <unordered_map>
 #include <functional>
-#include "../types/TimedResult.h"
+#include <optional>
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+#include "warmStart.h"
 
 struct ForcePoint {
     float oldX;
@@ -14,13 +19,43 @@ struct ForcePoint {
 };
 
 void computeFreeseLayout(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
     std::function<void(double)> onProgress
 );
 
+/**
+ * Computes the Freese layout with the ranks of the concepts already assigned by assignRanksToNodes.
+ */
+void computeFreeseLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<int>& ranksMapping,
+    std::unordered_map<int, int>& rankCounts,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
+    std::function<void(double)> onProgress
+);
+
+/**
+ * Assigns a rank (vertical position) to each concept and counts the concepts of each rank.
+ */
+std::unique_ptr<std::tuple<std::vector<int>, std::unordered_map<int, int>>> assignRanksToNodes(
+    int conceptsCount,
+    int supremum,
+    int infimum,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+);
+
 #endif
\ No newline at end of file
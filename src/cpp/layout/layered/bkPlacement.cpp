@@ -4,6 +4,7 @@
 // Strongly inspired by https://github.com/dagrejs/dagre/blob/master/lib/position/bk.js
 
 #include "../utils.h"
+#include "../../parallel.h"
 #include "../../types/ProgressData.h"
 #include "placement.h"
 
@@ -71,7 +72,7 @@ void addConflict(
 }
 
 bool hasConflict(
-    Conflicts& conflicts,
+    const Conflicts& conflicts,
     int from,
     int to
 ) {
@@ -79,8 +80,11 @@ bool hasConflict(
         std::swap(from, to);
     }
 
-    return conflicts.find(from) != conflicts.end() &&
-        conflicts[from].find(to) != conflicts[from].end();
+    // Conflicts are only read here, so they can be shared by concurrently computed alignments
+    auto fromConflicts = conflicts.find(from);
+
+    return fromConflicts != conflicts.end() &&
+        fromConflicts->second.find(to) != fromConflicts->second.end();
 }
 
 void markConflicts(
@@ -199,7 +203,7 @@ void verticalAlignment(
     std::vector<std::unordered_set<int>>& superconceptsMapping,
     int conceptsCount,
     std::vector<int>& horizontalOrder,
-    Conflicts& conflicts,
+    const Conflicts& conflicts,
     NodesList& alignedNodes,
     NodesList& roots,
     bool up,
@@ -495,36 +499,51 @@ void bkPlacement(
         progress);
 
     std::array<std::vector<float>, 4> horizontalCoords;
+    // Linked lists of references to lower nodes in node's block
+    std::array<NodesList, 4> alignedNodes;
+    // Linked lists of references to roots of the node blocks
+    std::array<NodesList, 4> roots;
+
+    // The alignments are independent of each other, the only shared data (conflicts) are read-only
+    int threadsCount = getThreadsCount(4);
+    std::array<int, 4> alignmentsCounts = { 0, 0, 0, 0 };
+
+    runInParallel(threadsCount, [&](int threadIndex) {
+        // Progress can be reported only from the calling thread, other threads stay silent
+        ProgressData silentProgress(1, [](double) {});
+        ProgressData& threadProgress = threadIndex == 0 ? progress : silentProgress;
+
+        for (int i = threadIndex; i < 4; i += threadsCount) {
+            verticalAlignment(
+                layers,
+                subconceptsMapping,
+                superconceptsMapping,
+                conceptsCount,
+                horizontalOrder,
+                conflicts,
+                alignedNodes[i],
+                roots[i],
+                isAlignmentUp(i),
+                isAlignmentLeft(i),
+                threadProgress);
+
+            horizontalCompaction(
+                alignedNodes[i],
+                roots[i],
+                horizontalOrder,
+                predecessors,
+                horizontalCoords[i],
+                delta,
+                threadProgress);
+
+            alignmentsCounts[threadIndex]++;
+        }
+    });
+
+    int silentAlignmentsCount = 4 - alignmentsCounts[0];
 
-    for (int i = 0; i < 4; i++) {
-        bool up = isAlignmentUp(i);
-        bool left = isAlignmentLeft(i);
-
-        // Linked list of references to lower nodes in node's block
-        NodesList alignedNodes;
-        // Linked list of references to roots of the node blocks
-        NodesList roots;
-        verticalAlignment(
-            layers,
-            subconceptsMapping,
-            superconceptsMapping,
-            conceptsCount,
-            horizontalOrder,
-            conflicts,
-            alignedNodes,
-            roots,
-            up,
-            left,
-            progress);
-
-        horizontalCompaction(
-            alignedNodes,
-            roots,
-            horizontalOrder,
-            predecessors,
-            horizontalCoords[i],
-            delta,
-            progress);
+    if (silentAlignmentsCount > 0) {
+        progress.finishBlocks(2 * silentAlignmentsCount);
     }
 
     auto [minWidthIndex, minWidth] = getMinWidthCoords(horizontalCoords);
@@ -4,6 +4,8 @@
 // Strongly inspired by https://github.com/dagrejs/dagre/blob/master/lib/order/cross-count.js
 
 
+#include "../../parallel.h"
+#include "../../trace.h"
 #include "crossCount.h"
 
 #include <vector>
@@ -11,6 +13,9 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <atomic>
+
+#define PARALLEL_CROSS_COUNT_MIN_EDGES 10000
 
 long long twoLayerCrossCount(
     std::vector<int>& northLayer,
@@ -21,26 +26,17 @@ long long twoLayerCrossCount(
 ) {
     // Create the permutation
 
+    int offset = horizontalPositions[southLayer[0]];
+
     for (int northNode : northLayer) {
         int startIndex = datastructures.permutation.size();
-        auto& subnodes = subconceptsMapping[northNode];
-
-        std::vector<int> southNodePositions;
-        southNodePositions.reserve(subnodes.size());
 
-        int offset = horizontalPositions[southLayer[0]];
-
-        std::transform(
-            subnodes.begin(), subnodes.end(), 
-            std::back_inserter(southNodePositions),
-            [&horizontalPositions, &offset](int southNode) {
-                return horizontalPositions[southNode] - offset;
-            }
-        );
-
-        std::sort(southNodePositions.begin(), southNodePositions.end());
+        // Positions of the south nodes are sorted in place, no temporary buffer is needed
+        for (int southNode : subconceptsMapping[northNode]) {
+            datastructures.permutation.push_back(horizontalPositions[southNode] - offset);
+        }
 
-        datastructures.permutation.insert(datastructures.permutation.end(), southNodePositions.begin(), southNodePositions.end());
+        std::sort(datastructures.permutation.begin() + startIndex, datastructures.permutation.end());
     }
 
     // Build the accumulator tree
@@ -77,9 +73,23 @@ long long twoLayerCrossCount(
     datastructures.permutation.clear();
     datastructures.tree.clear();
 
+    TRACE_COUNTER("crossCount.layerPairs", 1);
+    TRACE_COUNTER("crossCount.crossings", count);
+
     return count;
 }
 
+std::size_t countEdges(std::vector<std::unordered_set<int>>& subconceptsMapping) {
+    return std::accumulate(
+        subconceptsMapping.begin(),
+        subconceptsMapping.end(),
+        (std::size_t)0,
+        [](std::size_t currentSum, const std::unordered_set<int>& subconcepts) {
+            return currentSum + subconcepts.size();
+        }
+    );
+}
+
 long long crossCount(
     std::vector<std::vector<int>>& layers,
     std::vector<int>& horizontalPositions,
@@ -87,21 +97,13 @@ long long crossCount(
     CrossCountDataStructures& datastructures
 ) {
     // Preallocate the data structures
-    std::size_t edgesCount = std::accumulate(
-        subconceptsMapping.begin(),
-        subconceptsMapping.end(),
-        0,
-        [](std::size_t currentSum, const std::unordered_set<int>& subconcepts) {
-            return currentSum + subconcepts.size();
-        }
-    );
-    datastructures.permutation.reserve(edgesCount);
+    datastructures.permutation.reserve(countEdges(subconceptsMapping));
     datastructures.tree.reserve(subconceptsMapping.size());
 
     long long count = 0;
 
     // First and last layers can be ignored, there will not be any crossings
-    for (int i = 1; i < layers.size() - 2; i++) {
+    for (int i = 1; i < (int)layers.size() - 2; i++) {
         count += twoLayerCrossCount(
             layers[i],
             layers[i + 1],
@@ -111,4 +113,107 @@ long long crossCount(
     }
 
     return count;
+}
+
+void countLayerPairs(
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& pairs,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<CrossCountDataStructures>& threadsDatastructures,
+    std::vector<long long>& pairCounts
+) {
+    std::size_t edgesCount = countEdges(subconceptsMapping);
+    int threadsCount = edgesCount < PARALLEL_CROSS_COUNT_MIN_EDGES ?
+        1 :
+        getThreadsCount(pairs.size());
+
+    if (threadsDatastructures.size() < threadsCount) {
+        threadsDatastructures.resize(threadsCount);
+    }
+
+    // Layer pairs differ in size a lot, so they are handed out one by one
+    std::atomic<int> nextPair(0);
+
+    runInParallel(threadsCount, [&](int threadIndex) {
+        auto& datastructures = threadsDatastructures[threadIndex];
+        datastructures.permutation.reserve(edgesCount);
+        datastructures.tree.reserve(subconceptsMapping.size());
+
+        for (int i = nextPair++; i < pairs.size(); i = nextPair++) {
+            int pair = pairs[i];
+
+            // Each pair is written by exactly one thread
+            pairCounts[pair] = twoLayerCrossCount(
+                layers[pair],
+                layers[pair + 1],
+                horizontalPositions,
+                subconceptsMapping,
+                datastructures);
+        }
+    });
+}
+
+long long parallelCrossCount(
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<CrossCountDataStructures>& threadsDatastructures
+) {
+    LayerPairsCrossCounts crossCounts;
+
+    return initLayerPairsCrossCounts(
+        crossCounts,
+        layers,
+        horizontalPositions,
+        subconceptsMapping,
+        threadsDatastructures);
+}
+
+long long initLayerPairsCrossCounts(
+    LayerPairsCrossCounts& crossCounts,
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<CrossCountDataStructures>& threadsDatastructures
+) {
+    crossCounts.pairCounts.assign(std::max((int)layers.size() - 1, 0), 0);
+    crossCounts.total = 0;
+
+    std::vector<int> pairs;
+
+    // First and last layers can be ignored, there will not be any crossings
+    for (int i = 1; i < (int)layers.size() - 2; i++) {
+        pairs.push_back(i);
+    }
+
+    countLayerPairs(layers, pairs, horizontalPositions, subconceptsMapping, threadsDatastructures, crossCounts.pairCounts);
+
+    crossCounts.total = std::accumulate(crossCounts.pairCounts.begin(), crossCounts.pairCounts.end(), 0ll);
+
+    return crossCounts.total;
+}
+
+long long updateLayerPairsCrossCounts(
+    LayerPairsCrossCounts& crossCounts,
+    std::vector<std::vector<int>>& previousLayers,
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<CrossCountDataStructures>& threadsDatastructures
+) {
+    std::vector<int> pairs;
+
+    // A pair has to be recounted only if at least one of its layers has been reordered
+    for (int i = 1; i < (int)layers.size() - 2; i++) {
+        if (previousLayers[i] != layers[i] || previousLayers[i + 1] != layers[i + 1]) {
+            pairs.push_back(i);
+        }
+    }
+
+    countLayerPairs(layers, pairs, horizontalPositions, subconceptsMapping, threadsDatastructures, crossCounts.pairCounts);
+
+    crossCounts.total = std::accumulate(crossCounts.pairCounts.begin(), crossCounts.pairCounts.end(), 0ll);
+
+    return crossCounts.total;
 }
\ No newline at end of file
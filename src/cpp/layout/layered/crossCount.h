@@ -9,6 +9,12 @@ struct CrossCountDataStructures {
     std::vector<int> tree;
 };
 
+struct LayerPairsCrossCounts {
+    // Crossings between the layer i and i + 1
+    std::vector<long long> pairCounts;
+    long long total;
+};
+
 /// @brief Counts edge crossings in the layers. The layers need to be sorted by horizontal positions.
 /// @param layers
 /// @param horizontalPositions
@@ -21,4 +27,52 @@ long long crossCount(
     CrossCountDataStructures& datastructures
 );
 
+/// @brief Counts edge crossings in the layers. Independent layer pairs are counted in parallel.
+/// The layers need to be sorted by horizontal positions.
+/// @param layers
+/// @param horizontalPositions
+/// @param subconceptsMapping
+/// @param threadsDatastructures Data structures of each thread, they are reused between calls
+/// @return
+long long parallelCrossCount(
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<CrossCountDataStructures>& threadsDatastructures
+);
+
+/// @brief Counts edge crossings of each layer pair and stores them, so that they can be updated later.
+/// Independent layer pairs are counted in parallel. The layers need to be sorted by horizontal positions.
+/// @param crossCounts
+/// @param layers
+/// @param horizontalPositions
+/// @param subconceptsMapping
+/// @param threadsDatastructures Data structures of each thread, they are reused between calls
+/// @return Total count of the crossings
+long long initLayerPairsCrossCounts(
+    LayerPairsCrossCounts& crossCounts,
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<CrossCountDataStructures>& threadsDatastructures
+);
+
+/// @brief Updates the stored crossing counts after the layers were reordered.
+/// Only the pairs adjacent to a layer whose order differs from the previous one are recounted.
+/// @param crossCounts Counts of the previous layers, they are updated to the new layers
+/// @param previousLayers Layers that crossCounts correspond to
+/// @param layers Reordered layers, horizontalPositions need to correspond to them
+/// @param horizontalPositions
+/// @param subconceptsMapping
+/// @param threadsDatastructures Data structures of each thread, they are reused between calls
+/// @return Total count of the crossings
+long long updateLayerPairsCrossCounts(
+    LayerPairsCrossCounts& crossCounts,
+    std::vector<std::vector<int>>& previousLayers,
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<CrossCountDataStructures>& threadsDatastructures
+);
+
 #endif
\ No newline at end of file
@@ -1,113 +1,87 @@
 #include "../../utils.h"
 #include "../../types/ProgressData.h"
+#include "../../trace.h"
 
 #include <stdio.h>
 #include <vector>
 #include <memory>
 #include <unordered_set>
-#include <unordered_map>
 #include <algorithm>
+#include <numeric>
+#include <utility>
 
-void addSubconceptToMapping(std::unordered_map<int, std::vector<int>> & subconceptsMapping, int superconcept, int subconcept) {
-    if (subconceptsMapping.count(superconcept) == 1) {
-        std::vector<int>& subconcepts = subconceptsMapping[superconcept];
-        subconcepts.push_back(subconcept);
-    }
-    else {
-        subconceptsMapping.insert({ superconcept, { subconcept } });
+void collectLongEdges(
+    const std::vector<std::unordered_set<int>>& subconceptsMapping,
+    const std::vector<int>& layersMapping,
+    std::vector<int>& dummiesCountsOfLayers,
+    std::vector<std::pair<int, int>>& longEdges
+) {
+    for (int from = 0; from < subconceptsMapping.size(); from++) {
+        int fromLayer = layersMapping[from];
+
+        for (int to : subconceptsMapping[from]) {
+            int toLayer = layersMapping[to];
+
+            if (abs(toLayer - fromLayer) <= 1) {
+                // The layers are neighboring, no dummies need to be added
+                continue;
+            }
+
+            for (int layer = fromLayer + 1; layer < toLayer; layer++) {
+                dummiesCountsOfLayers[layer]++;
+            }
+
+            longEdges.push_back({ from, to });
+        }
     }
 }
 
 void addDummiesToLayers(
     int conceptsCount,
-    const std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
     const std::vector<int>& layersMapping,
-    std::vector<int>& horizontalPositions,
+    const std::vector<std::pair<int, int>>& longEdges,
+    std::vector<float>& sortPositions,
     std::vector<std::vector<int>>& layersWithDummies,
-    std::unordered_map<int, std::vector<int>>& dummySubconceptsMapping,
-    std::unordered_map<int, std::vector<int>>& subconceptsToRemove,
-    std::unordered_map<int, std::vector<int>>& dummySuperconceptsMapping,
-    std::unordered_map<int, std::vector<int>>& superconceptsToRemove,
     ProgressData& progress
 ) {
-    progress.beginBlock(subconceptsMapping.size());
+    progress.beginBlock(longEdges.size());
 
     int newDummy = conceptsCount;
 
-    for (int from = 0; from < subconceptsMapping.size(); from++) {
+    for (int e = 0; e < longEdges.size(); e++) {
+        auto [from, to] = longEdges[e];
         int fromLayer = layersMapping[from];
+        int toLayer = layersMapping[to];
 
-        for (int to : subconceptsMapping[from]) {
-            int toLayer = layersMapping[to];
-            int diff = abs(toLayer - fromLayer);
+        // The dummies are placed on the straight line between the end nodes
+        int previousSuperconcept = from;
 
-            if (diff <= 1) {
-                // The layers are neighboring, no dummies need to be added
-                continue;
-            }
+        for (int i = 1; i < toLayer - fromLayer; i++) {
+            float ratio = (float)i / (toLayer - fromLayer);
 
-            // Dummies need to be added 
-            int previousSuperconcept = from;
-
-            for (int i = 1; i <= diff - 1; i++) {
-                float ratio = (float)i / (toLayer - fromLayer);
-                int newDummyHorizontalPosition = (int)round(
-                    (ratio * (horizontalPositions[to] - horizontalPositions[from])) + horizontalPositions[from]);
-                std::vector<int>& targetLayer = layersWithDummies[fromLayer + i];
-
-                if (newDummyHorizontalPosition + 1 > targetLayer.size()) {
-                    targetLayer.push_back(newDummy);
-                }
-                else {
-                    targetLayer.insert(targetLayer.begin() + newDummyHorizontalPosition, newDummy);
-                }
-                horizontalPositions.push_back(newDummyHorizontalPosition);
-
-                // Move nodes that follow the newly inserted dummy
-                for (int j = newDummyHorizontalPosition + 1; j < targetLayer.size(); j++) {
-                    horizontalPositions[targetLayer[j]]++;
-                }
-
-                addSubconceptToMapping(dummySubconceptsMapping, previousSuperconcept, newDummy);
-                addSubconceptToMapping(dummySuperconceptsMapping, newDummy, previousSuperconcept);
-
-                previousSuperconcept = newDummy;
-                newDummy++;
-            }
+            sortPositions[newDummy] = (ratio * (sortPositions[to] - sortPositions[from])) + sortPositions[from];
+            layersWithDummies[fromLayer + i].push_back(newDummy);
 
-            addSubconceptToMapping(dummySubconceptsMapping, previousSuperconcept, to);
-            addSubconceptToMapping(dummySuperconceptsMapping, to, previousSuperconcept);
+            subconceptsMapping[previousSuperconcept].insert(newDummy);
+            superconceptsMapping[newDummy].insert(previousSuperconcept);
 
-            addSubconceptToMapping(subconceptsToRemove, from, to);
-            addSubconceptToMapping(superconceptsToRemove, to, from);
+            previousSuperconcept = newDummy;
+            newDummy++;
         }
 
-        progress.progress(from + 1);
-    }
+        subconceptsMapping[previousSuperconcept].insert(to);
+        superconceptsMapping[to].insert(previousSuperconcept);
 
-    progress.finishBlock();
-}
+        // Remove the transitive relation
+        subconceptsMapping[from].erase(to);
+        superconceptsMapping[to].erase(from);
 
-void mergeMappings(
-    std::vector<std::unordered_set<int>>& mapping,
-    std::unordered_map<int, std::vector<int>>& dummyMapping
-) {
-    for (const auto& [concept, subconcepts] : dummyMapping) {
-        for (auto subconcept : subconcepts) {
-            mapping[concept].insert(subconcept);
-        }
+        progress.progress(e + 1);
     }
-}
 
-void removeNodesFromMapping(
-    std::vector<std::unordered_set<int>>& mapping,
-    std::unordered_map<int, std::vector<int>>& nodesToRemove
-) {
-    for (const auto& [node, subnodes] : nodesToRemove) {
-        for (auto subnode : subnodes) {
-            mapping[node].erase(subnode);
-        }
-    }
+    progress.finishBlock();
 }
 
 std::unique_ptr<std::tuple<
@@ -121,17 +95,26 @@ std::unique_ptr<std::tuple<
     const std::vector<int>& layersMapping,
     ProgressData& progress
 ) {
+    TRACE_SCOPE("layeredLayout.addDummies");
+
     auto result = std::make_unique<std::tuple<
         std::vector<std::vector<int>>,
         std::vector<int>>>();
     auto& [layersWithDummies, horizontalPositions] = *result;
 
-    std::unordered_map<int, std::vector<int>> dummySubconceptsMapping;
-    std::unordered_map<int, std::vector<int>> subconceptsToRemove;
-    std::unordered_map<int, std::vector<int>> dummySuperconceptsMapping;
-    std::unordered_map<int, std::vector<int>> superconceptsToRemove;
+    // Dummies are counted first, so that everything can be allocated at once
+    std::vector<int> dummiesCountsOfLayers(layers.size(), 0);
+    std::vector<std::pair<int, int>> longEdges;
+
+    collectLongEdges(subconceptsMapping, layersMapping, dummiesCountsOfLayers, longEdges);
 
-    horizontalPositions.resize(conceptsCount);
+    int nodesCount = conceptsCount + std::accumulate(dummiesCountsOfLayers.begin(), dummiesCountsOfLayers.end(), 0);
+
+    // Horizontal positions that the nodes are sorted by in their layers
+    std::vector<float> sortPositions(nodesCount);
+    horizontalPositions.resize(nodesCount);
+    subconceptsMapping.resize(nodesCount);
+    superconceptsMapping.resize(nodesCount);
     layersWithDummies.resize(layers.size());
 
     int maxLayerSize = maxSizeOfSets(layers);
@@ -144,49 +127,41 @@ std::unique_ptr<std::tuple<
         // so that the layer is aligned with the center vertical axis
         int j = 0;
         for (auto value : layer) {
-            horizontalPositions[value] = j + offset;
+            sortPositions[value] = j + offset;
             j++;
         }
 
         // Copy the current layer to the new collection that will contain dummies too
+        layersWithDummies[i].reserve(layer.size() + dummiesCountsOfLayers[i]);
         layersWithDummies[i].insert(layersWithDummies[i].end(), layer.begin(), layer.end());
     }
 
     addDummiesToLayers(
         conceptsCount,
         subconceptsMapping,
+        superconceptsMapping,
         layersMapping,
-        horizontalPositions,
+        longEdges,
+        sortPositions,
         layersWithDummies,
-        dummySubconceptsMapping,
-        subconceptsToRemove,
-        dummySuperconceptsMapping,
-        superconceptsToRemove,
         progress);
 
-    // Add dummies to the cover relation mappings
-    subconceptsMapping.resize(horizontalPositions.size());
-    superconceptsMapping.resize(horizontalPositions.size());
-    mergeMappings(subconceptsMapping, dummySubconceptsMapping);
-    mergeMappings(superconceptsMapping, dummySuperconceptsMapping);
-
-    // Remove the transitive relations from the mappings
-    removeNodesFromMapping(subconceptsMapping, subconceptsToRemove);
-    removeNodesFromMapping(superconceptsMapping, superconceptsToRemove);
-
     // Make the coords precise
     int maxWithDummies = maxSizeOfVectors(layersWithDummies);
 
     for (int i = 0; i < layersWithDummies.size(); i++) {
-        std::unordered_set<int>& layer = layers[i];
+        std::vector<int>& layer = layersWithDummies[i];
         float offset = (float)(maxWithDummies - layer.size()) / 2;
-        int j = 0;
+
+        // Nodes that share a position keep the order in which they were added
+        std::stable_sort(layer.begin(), layer.end(), [&](int a, int b) {
+            return sortPositions[a] < sortPositions[b];
+        });
 
         // Set correct horizontal positions of the nodes in the current layer,
         // so that the layer is aligned with the center vertical axis
-        for (auto value : layer) {
-            horizontalPositions[value] = j + offset;
-            j++;
+        for (int j = 0; j < layer.size(); j++) {
+            horizontalPositions[layer[j]] = j + offset;
         }
     }
 
@@ -1,4 +1,6 @@
 #include "../../utils.h"
+#include "../../memory.h"
+#include "../../trace.h"
 #include "../../types/TimedResult.h"
 #include "../../types/ProgressData.h"
 #include "../utils.h"
@@ -7,6 +9,7 @@
 #include "layeredLayout.h"
 #include "placement.h"
 #include "crossCount.h"
+#include "../../parallel.h"
 
 #include <stdio.h>
 #include <iostream>
@@ -17,6 +20,7 @@
 #include <algorithm>
 #include <functional>
 #include <exception>
+#include <random>
 
 using PlacementDelegate = std::function<void(
     std::vector<float>&,
@@ -27,7 +31,12 @@ using PlacementDelegate = std::function<void(
     ProgressData&
 )>;
 
-#define MAX_ITERATIONS_COUNT 5
+using LayeringDelegate = std::function<std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>>(
+    int,
+    std::vector<std::unordered_set<int>>&,
+    std::vector<std::unordered_set<int>>&
+)>;
+
 
 void calculateAveragePositionsOfLayer(
     std::vector<int>& layer,
@@ -160,14 +169,169 @@ std::unique_ptr<std::vector<std::vector<int>>> reduceCrossingsUsingAverage(
     return orderedLayers;
 }
 
+void assignHorizontalPositions(
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions
+) {
+    for (auto& layer : layers) {
+        if (layer.empty()) {
+            continue;
+        }
+
+        // The set of positions occupied by a layer never changes, only their assignment to the nodes
+        int offset = horizontalPositions[layer[0]];
+        for (int node : layer) {
+            offset = std::min(offset, horizontalPositions[node]);
+        }
+
+        for (int j = 0; j < layer.size(); j++) {
+            horizontalPositions[layer[j]] = j + offset;
+        }
+    }
+}
+
+void collectSortedNeighbourPositions(
+    std::vector<int>& layer,
+    std::vector<std::unordered_set<int>>& mapping,
+    std::vector<int>& horizontalPositions,
+    std::vector<int>& positions,
+    std::vector<int>& starts
+) {
+    // Neighbours do not move while the layer is being reordered,
+    // so their positions are sorted only once per visit of the layer
+    positions.clear();
+
+    for (int node : layer) {
+        starts[node] = positions.size();
+
+        for (int neighbour : mapping[node]) {
+            positions.push_back(horizontalPositions[neighbour]);
+        }
+
+        std::sort(positions.begin() + starts[node], positions.end());
+    }
+}
+
+long long crossingsDeltaOfSwap(
+    int left,
+    int right,
+    std::vector<std::unordered_set<int>>& mapping,
+    std::vector<int>& positions,
+    std::vector<int>& starts
+) {
+    int* leftPositions = positions.data() + starts[left];
+    int* rightPositions = positions.data() + starts[right];
+    int leftCount = mapping[left].size();
+    int rightCount = mapping[right].size();
+
+    // Edges of the left node cross edges of the right node that end further left,
+    // after the swap they cross the edges that end further right
+    long long before = 0;
+    long long after = 0;
+    int lowerCount = 0;
+    int lowerOrEqualCount = 0;
+
+    for (int i = 0; i < leftCount; i++) {
+        int position = leftPositions[i];
+
+        while (lowerCount < rightCount && rightPositions[lowerCount] < position) {
+            lowerCount++;
+        }
+        while (lowerOrEqualCount < rightCount && rightPositions[lowerOrEqualCount] <= position) {
+            lowerOrEqualCount++;
+        }
+
+        before += lowerCount;
+        after += rightCount - lowerOrEqualCount;
+    }
+
+    return after - before;
+}
+
+void reduceCrossingsUsingSwaps(
+    std::vector<std::vector<int>>& layers,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    int timeBudget,
+    ProgressData& progress
+) {
+    // Greedy exchange of adjacent nodes – a swap changes only the crossings between the edges of the two nodes,
+    // so its effect can be computed locally and every performed swap strictly decreases the crossings count.
+    // The ordering is therefore never worse than the previous one and can be interrupted at any time.
+
+    long long startTime = nowMills();
+
+    progress.beginBlock(layers.size());
+
+    std::vector<int> superPositions;
+    std::vector<int> subPositions;
+    std::vector<int> superStarts(horizontalPositions.size());
+    std::vector<int> subStarts(horizontalPositions.size());
+    bool improved = true;
+    bool isFirstSweep = true;
+
+    auto isOutOfTime = [&]() {
+        return timeBudget > 0 && nowMills() - startTime >= timeBudget;
+    };
+
+    while (improved) {
+        improved = false;
+
+        for (int i = 0; i < layers.size(); i++) {
+            if (isOutOfTime()) {
+                improved = false;
+                break;
+            }
+
+            auto& layer = layers[i];
+
+            collectSortedNeighbourPositions(layer, superconceptsMapping, horizontalPositions, superPositions, superStarts);
+            collectSortedNeighbourPositions(layer, subconceptsMapping, horizontalPositions, subPositions, subStarts);
+
+            // Swaps are repeated until the layer is locally optimal
+            bool layerImproved = true;
+
+            while (layerImproved && !isOutOfTime()) {
+                layerImproved = false;
+
+                for (int j = 0; j + 1 < layer.size(); j++) {
+                    int left = layer[j];
+                    int right = layer[j + 1];
+
+                    long long delta =
+                        crossingsDeltaOfSwap(left, right, superconceptsMapping, superPositions, superStarts) +
+                        crossingsDeltaOfSwap(left, right, subconceptsMapping, subPositions, subStarts);
+
+                    if (delta < 0) {
+                        std::swap(layer[j], layer[j + 1]);
+                        std::swap(horizontalPositions[left], horizontalPositions[right]);
+                        layerImproved = true;
+                        improved = true;
+                    }
+                }
+            }
+
+            if (isFirstSweep) {
+                progress.progress(i + 1);
+            }
+        }
+
+        isFirstSweep = false;
+    }
+
+    progress.finishBlock();
+}
+
 std::unique_ptr<std::vector<std::vector<int>>> reduceCrossings(
     std::vector<std::vector<int>>& layersWithDummies,
     std::vector<int>& horizontalPositions,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
+    int timeBudget,
     ProgressData& progress
 ) {
-    CrossCountDataStructures crossCountDataStructures;
+    std::vector<CrossCountDataStructures> crossCountDataStructures;
 
     auto bestOrderedLayers = reduceCrossingsUsingAverage(
         layersWithDummies,
@@ -179,7 +343,9 @@ std::unique_ptr<std::vector<std::vector<int>>> reduceCrossings(
     int iteration = 0;
 
     try {
-        long long bestCount = crossCount(*bestOrderedLayers, horizontalPositions, subconceptsMapping, crossCountDataStructures);
+        // Counts of the layer pairs always correspond to the last ordering
+        LayerPairsCrossCounts crossCounts;
+        long long bestCount = initLayerPairsCrossCounts(crossCounts, *bestOrderedLayers, horizontalPositions, subconceptsMapping, crossCountDataStructures);
         long long lastCount = bestCount;
         std::unique_ptr<std::vector<std::vector<int>>> lastOrderedLayers = nullptr;
 
@@ -188,14 +354,23 @@ std::unique_ptr<std::vector<std::vector<int>>> reduceCrossings(
                 break;
             }
 
-            lastOrderedLayers = std::move(reduceCrossingsUsingAverage(
-                lastOrderedLayers == nullptr ? *bestOrderedLayers : *lastOrderedLayers,
+            auto previousOrderedLayers = std::move(lastOrderedLayers);
+            auto& previousLayers = previousOrderedLayers == nullptr ? *bestOrderedLayers : *previousOrderedLayers;
+
+            lastOrderedLayers = reduceCrossingsUsingAverage(
+                previousLayers,
                 horizontalPositions,
                 subconceptsMapping,
                 superconceptsMapping,
-                progress));
+                progress);
 
-            long long newCount = crossCount(*lastOrderedLayers, horizontalPositions, subconceptsMapping, crossCountDataStructures);
+            long long newCount = updateLayerPairsCrossCounts(
+                crossCounts,
+                previousLayers,
+                *lastOrderedLayers,
+                horizontalPositions,
+                subconceptsMapping,
+                crossCountDataStructures);
 
             iteration++;
 
@@ -224,9 +399,94 @@ std::unique_ptr<std::vector<std::vector<int>>> reduceCrossings(
         progress.finishBlocks((MAX_ITERATIONS_COUNT - iteration) * 3);
     }
 
+    // Positions may belong to a later attempt that turned out to be worse
+    assignHorizontalPositions(*bestOrderedLayers, horizontalPositions);
+
+    reduceCrossingsUsingSwaps(
+        *bestOrderedLayers,
+        horizontalPositions,
+        subconceptsMapping,
+        superconceptsMapping,
+        timeBudget,
+        progress);
+
     return bestOrderedLayers;
 }
 
+/**
+ * Reduces crossings starting from the order given by the dummies and from restartsCount random shuffles of the layers,
+ * the starts are distributed among the threads. The ordering with the lowest count of crossings is kept.
+ *
+ * The shuffle of the start i is seeded by i, so the result does not depend on the number of threads
+ * as long as no start runs out of its time budget.
+ * The time budget is split among the rounds of starts run by each thread, so that all the starts together take about as long as the budget.
+ * Only the first start reports progress.
+ */
+std::unique_ptr<std::vector<std::vector<int>>> reduceCrossingsWithRestarts(
+    std::vector<std::vector<int>>& layersWithDummies,
+    std::vector<int>& horizontalPositions,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    int timeBudget,
+    int restartsCount,
+    ProgressData& progress
+) {
+    TRACE_SCOPE("layeredLayout.reduceCrossings");
+
+    if (restartsCount <= 0) {
+        return reduceCrossings(
+            layersWithDummies,
+            horizontalPositions,
+            subconceptsMapping,
+            superconceptsMapping,
+            timeBudget,
+            progress);
+    }
+
+    int startsCount = restartsCount + 1;
+    int threadsCount = getThreadsCount(startsCount);
+    int roundsCount = (startsCount + threadsCount - 1) / threadsCount;
+    int startTimeBudget = timeBudget > 0 ? std::max(1, timeBudget / roundsCount) : timeBudget;
+    std::vector<std::unique_ptr<std::vector<std::vector<int>>>> orderedLayers(startsCount);
+    std::vector<std::vector<int>> positions(startsCount);
+    std::vector<long long> crossingsCounts(startsCount);
+
+    runInParallel(threadsCount, [&](int threadIndex) {
+        ProgressData silentProgress(progress.totalBlocks, [](double) {});
+        CrossCountDataStructures crossCountDataStructures;
+
+        for (int start = threadIndex; start < startsCount; start += threadsCount) {
+            std::vector<std::vector<int>> layers = layersWithDummies;
+            positions[start] = horizontalPositions;
+
+            if (start > 0) {
+                std::mt19937 generator(start);
+
+                for (auto& layer : layers) {
+                    std::shuffle(layer.begin(), layer.end(), generator);
+                }
+
+                assignHorizontalPositions(layers, positions[start]);
+            }
+
+            orderedLayers[start] = reduceCrossings(
+                layers,
+                positions[start],
+                subconceptsMapping,
+                superconceptsMapping,
+                startTimeBudget,
+                start == 0 ? progress : silentProgress);
+            crossingsCounts[start] = crossCount(*orderedLayers[start], positions[start], subconceptsMapping, crossCountDataStructures);
+        }
+    });
+
+    // Ties are broken by the index of the start to keep the result deterministic
+    int bestStart = std::min_element(crossingsCounts.begin(), crossingsCounts.end()) - crossingsCounts.begin();
+    horizontalPositions = std::move(positions[bestStart]);
+
+    return std::move(orderedLayers[bestStart]);
+}
+
 void createLayout(
     TimedResult<std::vector<float>>& result,
     int conceptsCount,
@@ -236,6 +496,8 @@ void createLayout(
     ProgressData& progress,
     PlacementDelegate placement
 ) {
+    TRACE_SCOPE("layeredLayout.placement");
+
     result.value.resize(conceptsCount * COORDS_COUNT);
     placement(result.value, layers, subconceptsMapping, superconceptsMapping, conceptsCount, progress);
 }
@@ -250,6 +512,65 @@ PlacementDelegate getPlacementFunc(std::string placement) {
     return simplePlacement;
 }
 
+LayeringDelegate getLayeringFunc(std::string layering) {
+    if (layering == "coffmanGraham") {
+        return [](int supremum, auto& subconceptsMapping, auto& superconceptsMapping) {
+            return assignNodesToLayersByCoffmanGraham(supremum, subconceptsMapping, superconceptsMapping, 0);
+        };
+    }
+    if (layering == "networkSimplex") {
+        return assignNodesToLayersByNetworkSimplex;
+    }
+    return [](int supremum, auto& subconceptsMapping, auto& superconceptsMapping) {
+        auto subconcepts = createCompactMapping(subconceptsMapping);
+        return assignNodesToLayersByLongestPath(supremum, subconcepts);
+    };
+}
+
+int getPlacementProgressBlocksCount(const std::string& placement) {
+    return placement == "bk" ? (1 + (2 * 4) + 1 + 1) : 0;
+}
+
+std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> assignNodesToLayers(
+    int supremum,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::string layering
+) {
+    TRACE_SCOPE("layeredLayout.layering");
+
+    return getLayeringFunc(layering)(supremum, subconceptsMapping, superconceptsMapping);
+}
+
+std::unique_ptr<std::vector<std::vector<int>>> computeOrderedLayers(
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<int>& layersMapping,
+    std::vector<std::unordered_set<int>>& layers,
+    int crossingsTimeBudget,
+    int restartsCount,
+    ProgressData& progress
+) {
+    auto dummiesResult = addDummies(
+        conceptsCount,
+        subconceptsMapping,
+        superconceptsMapping,
+        layers,
+        layersMapping,
+        progress);
+    auto& [layersWithDummies, horizontalPositions] = *dummiesResult;
+
+    return reduceCrossingsWithRestarts(
+        layersWithDummies,
+        horizontalPositions,
+        subconceptsMapping,
+        superconceptsMapping,
+        crossingsTimeBudget,
+        restartsCount,
+        progress);
+}
+
 void computeLayeredLayout(
     TimedResult<std::vector<float>>& result,
     int supremum,
@@ -257,32 +578,30 @@ void computeLayeredLayout(
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
     std::string placement,
+    std::string layering,
+    int crossingsTimeBudget,
+    int restartsCount,
     std::function<void(double)> onProgress
 ) {
     long long startTime = nowMills();
+    MemoryTracker memoryTracker;
 
     auto progress = ProgressData(
-        1 + (3 * (MAX_ITERATIONS_COUNT + 1)) + (placement == "bk" ? (1 + (2 * 4) + 1 + 1) : 0),
+        ORDERED_LAYERS_PROGRESS_BLOCKS_COUNT + getPlacementProgressBlocksCount(placement),
         onProgress);
 
     // The layers are ordered from top to bottom – the first layer is at the top
-    auto layersResult = assignNodesToLayersByLongestPath(supremum, subconceptsMapping);
+    auto layersResult = assignNodesToLayers(supremum, subconceptsMapping, superconceptsMapping, layering);
     auto& [layersMapping, layers] = *layersResult;
 
-    auto dummiesResult = addDummies(
+    auto orderedLayers = computeOrderedLayers(
         conceptsCount,
         subconceptsMapping,
         superconceptsMapping,
-        layers,
         layersMapping,
-        progress);
-    auto& [layersWithDummies, horizontalPositions] = *dummiesResult;
-
-    auto orderedLayers = reduceCrossings(
-        layersWithDummies,
-        horizontalPositions,
-        subconceptsMapping,
-        superconceptsMapping,
+        layers,
+        crossingsTimeBudget,
+        restartsCount,
         progress);
 
     createLayout(
@@ -297,4 +616,32 @@ void computeLayeredLayout(
     long long endTime = nowMills();
 
     result.time = (int)endTime - startTime;
+    result.memory = memoryTracker.finish();
+}
+
+void computeLayeredLayout(
+    TimedResult<std::vector<float>>& result,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMappingWithDummies,
+    std::vector<std::unordered_set<int>>& superconceptsMappingWithDummies,
+    std::vector<std::vector<int>>& orderedLayers,
+    std::string placement,
+    ProgressData& progress
+) {
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    createLayout(
+        result,
+        conceptsCount,
+        subconceptsMappingWithDummies,
+        superconceptsMappingWithDummies,
+        orderedLayers,
+        progress,
+        getPlacementFunc(placement));
+
+    long long endTime = nowMills();
+
+    result.time = (int)endTime - startTime;
+    result.memory = memoryTracker.finish();
 }
\ No newline at end of file
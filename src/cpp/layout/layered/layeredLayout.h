@@ -2,9 +2,26 @@
 #define LAYERED_LAYOUT_H
 
 #include <vector>
+#include <memory>
 #include <unordered_set>
+#include <functional>
+#include <string>
 #include "../../types/TimedResult.h"
+#include "../../types/ProgressData.h"
 
+#define MAX_ITERATIONS_COUNT 5
+/// @brief Progress blocks of adding the dummy nodes, of the barycentric crossing reduction and of the adjacent swaps.
+#define ORDERED_LAYERS_PROGRESS_BLOCKS_COUNT (1 + (3 * (MAX_ITERATIONS_COUNT + 1)) + 1)
+
+/**
+ * Computes a layered layout of a concept lattice.
+ *
+ * @param layering Layer assignment algorithm – "longestPath", "coffmanGraham" or "networkSimplex"
+ * @param crossingsTimeBudget Time in milliseconds that can be spent by swapping adjacent nodes
+ * after the barycentric crossing reduction. Values less than or equal to zero disable the limit.
+ * @param restartsCount Number of additional crossing reductions that start from randomly shuffled layers
+ * and run concurrently. The ordering with the fewest crossings is kept. The time budget is shared by all the starts.
+ */
 void computeLayeredLayout(
     TimedResult<std::vector<float>> &result,
     int supremum,
@@ -12,6 +29,49 @@ void computeLayeredLayout(
     std::vector<std::unordered_set<int>> &subconceptsMapping,
     std::vector<std::unordered_set<int>> &superconceptsMapping,
     std::string placement,
+    std::string layering,
+    int crossingsTimeBudget,
+    int restartsCount,
     std::function<void(double)> onProgress);
 
+/**
+ * Computes a layered layout from layers that are already ordered to reduce edge crossings (see computeOrderedLayers).
+ * Only the placement is computed, so that the ordered layers can be reused by multiple placements.
+ */
+void computeLayeredLayout(
+    TimedResult<std::vector<float>> &result,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>> &subconceptsMappingWithDummies,
+    std::vector<std::unordered_set<int>> &superconceptsMappingWithDummies,
+    std::vector<std::vector<int>> &orderedLayers,
+    std::string placement,
+    ProgressData& progress);
+
+/// @brief Returns the number of progress blocks of the placement.
+int getPlacementProgressBlocksCount(const std::string& placement);
+
+/**
+ * Assigns the nodes to layers by the given layering algorithm.
+ * The layers are ordered from top to bottom – the first layer is at the top.
+ */
+std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> assignNodesToLayers(
+    int supremum,
+    std::vector<std::unordered_set<int>> &subconceptsMapping,
+    std::vector<std::unordered_set<int>> &superconceptsMapping,
+    std::string layering);
+
+/**
+ * Adds dummy nodes to the layers and orders the layers to reduce edge crossings.
+ * The dummy nodes are added to the mappings.
+ */
+std::unique_ptr<std::vector<std::vector<int>>> computeOrderedLayers(
+    int conceptsCount,
+    std::vector<std::unordered_set<int>> &subconceptsMapping,
+    std::vector<std::unordered_set<int>> &superconceptsMapping,
+    std::vector<int> &layersMapping,
+    std::vector<std::unordered_set<int>> &layers,
+    int crossingsTimeBudget,
+    int restartsCount,
+    ProgressData& progress);
+
 #endif
\ No newline at end of file
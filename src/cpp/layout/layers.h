@@ -5,9 +5,41 @@
 #include <vector>
 #include <memory>
 #include <unordered_set>
+#include "utils.h"
 
+/// @brief Groups the nodes by their layers.
+/// @param layersMapping Layer of each node, the layers need to start at 0, nodes with negative layers are skipped
+/// @return Layer of each node and nodes of each layer
+std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> createLayersFromMapping(
+    std::vector<int> layersMapping);
+
+/// @brief Assigns each node to the layer given by the length of the longest path from the start concept.
 std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> assignNodesToLayersByLongestPath(
     int startConceptIndex,
-    std::vector<std::unordered_set<int>>& coverRelation);
+    CompactMapping& coverRelation);
+
+/**
+ * Assigns the nodes to layers using the Coffman-Graham algorithm.
+ * A layer contains at most maxLayerWidth nodes, dummy nodes of long edges are not counted.
+ * If maxLayerWidth is not positive, the average width of the layers of the longest path layering is used.
+ * 
+ * The start concept is placed in the first (top) layer.
+ */
+std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> assignNodesToLayersByCoffmanGraham(
+    int startConceptIndex,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    int maxLayerWidth);
+
+/**
+ * Assigns the nodes to layers using the network simplex algorithm of Gansner et al.,
+ * so that the total span of all edges is minimal.
+ * 
+ * The start concept is placed in the first (top) layer.
+ */
+std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> assignNodesToLayersByNetworkSimplex(
+    int startConceptIndex,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,191 @@
+#include "../utils.h"
+#include "../memory.h"
+#include "../types/TimedResult.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+#include "../types/ProgressData.h"
+#include "layered/layeredLayout.h"
+#include "freeseLayout.h"
+#include "reDrawLayout.h"
+#include "multilevelLayout.h"
+#include "layoutSession.h"
+
+#include <vector>
+#include <memory>
+#include <unordered_set>
+#include <unordered_map>
+#include <functional>
+#include <optional>
+#include <string>
+
+LayoutSession::LayoutSession(
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>> subconceptsMapping,
+    std::vector<std::unordered_set<int>> superconceptsMapping
+) :
+    supremum(supremum),
+    infimum(infimum),
+    conceptsCount(conceptsCount),
+    subconceptsMapping(std::move(subconceptsMapping)),
+    superconceptsMapping(std::move(superconceptsMapping)) {
+}
+
+void LayoutSession::computeLayeredLayout(
+    TimedResult<std::vector<float>>& result,
+    std::string placement,
+    std::string layering,
+    int crossingsTimeBudget,
+    int restartsCount,
+    std::function<void(double)> onProgress
+) {
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    std::string key = layering + ";" + std::to_string(crossingsTimeBudget) + ";" + std::to_string(restartsCount);
+    bool hasOrderedLayers = orderedLayers && orderedLayers->key == key;
+
+    auto progress = ProgressData(
+        (hasOrderedLayers ? 0 : ORDERED_LAYERS_PROGRESS_BLOCKS_COUNT) + getPlacementProgressBlocksCount(placement),
+        onProgress);
+
+    if (!hasOrderedLayers) {
+        auto& layersResult = layers[layering];
+
+        if (!layersResult) {
+            layersResult = assignNodesToLayers(supremum, subconceptsMapping, superconceptsMapping, layering);
+        }
+
+        auto& [layersMapping, conceptLayers] = *layersResult;
+
+        // The dummy nodes are added to copies of the mappings, the original mappings are used by the other layouts
+        orderedLayers = std::make_unique<OrderedLayersCache>();
+        orderedLayers->key = key;
+        orderedLayers->subconceptsMapping = subconceptsMapping;
+        orderedLayers->superconceptsMapping = superconceptsMapping;
+        orderedLayers->layers = computeOrderedLayers(
+            conceptsCount,
+            orderedLayers->subconceptsMapping,
+            orderedLayers->superconceptsMapping,
+            layersMapping,
+            conceptLayers,
+            crossingsTimeBudget,
+            restartsCount,
+            progress);
+    }
+
+    ::computeLayeredLayout(
+        result,
+        conceptsCount,
+        orderedLayers->subconceptsMapping,
+        orderedLayers->superconceptsMapping,
+        *orderedLayers->layers,
+        placement,
+        progress);
+
+    // The simple and ellipse placements of cached ordered layers do not report any progress
+    if (progress.totalBlocks == 0) {
+        onProgress(1);
+    }
+
+    long long endTime = nowMills();
+
+    result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+}
+
+void LayoutSession::computeFreeseLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
+    std::function<void(double)> onProgress
+) {
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    if (!ranks) {
+        ranks = assignRanksToNodes(conceptsCount, supremum, infimum, subconceptsMapping, superconceptsMapping);
+    }
+
+    auto& [ranksMapping, rankCounts] = *ranks;
+
+    ::computeFreeseLayout(
+        result,
+        supremum,
+        infimum,
+        conceptsCount,
+        subconceptsMapping,
+        superconceptsMapping,
+        ranksMapping,
+        rankCounts,
+        convergenceCriteria,
+        warmStart,
+        onProgress);
+
+    long long endTime = nowMills();
+
+    result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+}
+
+void LayoutSession::computeReDrawLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
+    std::function<void(double)> onProgress
+) {
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    if (!topologicalOrder) {
+        topologicalOrder = computeReDrawTopologicalOrder(infimum, superconceptsMapping);
+    }
+
+    ::computeReDrawLayout(
+        result,
+        supremum,
+        infimum,
+        conceptsCount,
+        subconceptsMapping,
+        superconceptsMapping,
+        *topologicalOrder,
+        seed,
+        targetDimension,
+        parallelize,
+        convergenceCriteria,
+        warmStart,
+        onProgress);
+
+    long long endTime = nowMills();
+
+    result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+}
+
+void LayoutSession::computeMultilevelLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    std::function<void(double)> onProgress
+) {
+    ::computeMultilevelLayout(
+        result,
+        supremum,
+        infimum,
+        conceptsCount,
+        subconceptsMapping,
+        superconceptsMapping,
+        engine,
+        seed,
+        targetDimension,
+        parallelize,
+        convergenceCriteria,
+        onProgress);
+}
\ No newline at end of file
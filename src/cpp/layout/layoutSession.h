@@ -0,0 +1,100 @@
+#ifndef LAYOUT_SESSION_H
+#define LAYOUT_SESSION_H
+
+#include <vector>
+#include <memory>
+#include <unordered_set>
+#include <unordered_map>
+#include <functional>
+#include <optional>
+#include <string>
+#include "../types/TimedResult.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+#include "../types/MemoryUsage.h"
+#include "warmStart.h"
+
+/// @brief Layers with dummy nodes ordered by the crossing reduction, together with the mappings extended by the dummy nodes.
+struct OrderedLayersCache {
+    /// @brief Layering, crossings time budget and restarts count that the layers were computed with.
+    std::string key;
+    std::vector<std::unordered_set<int>> subconceptsMapping;
+    std::vector<std::unordered_set<int>> superconceptsMapping;
+    std::unique_ptr<std::vector<std::vector<int>>> layers;
+};
+
+/**
+ * Holds the cover relation of a single lattice and serves multiple layout computations of it.
+ *
+ * The mappings are built only once. Structures derived from them (layers, ranks, topological order)
+ * are computed lazily by the first layout that needs them and reused by the next layouts.
+ * The layers ordered by the crossing reduction are kept for the last used layering,
+ * so that switching between placements of the layered layout only recomputes the placement.
+ */
+class LayoutSession {
+public:
+    LayoutSession(
+        int supremum,
+        int infimum,
+        int conceptsCount,
+        std::vector<std::unordered_set<int>> subconceptsMapping,
+        std::vector<std::unordered_set<int>> superconceptsMapping);
+
+    int getSupremum() const { return supremum; }
+    int getInfimum() const { return infimum; }
+    int getConceptsCount() const { return conceptsCount; }
+
+    /// @brief Memory used by building the mappings that the session was created with.
+    MemoryUsage getMappingsMemory() const { return mappingsMemory; }
+    void setMappingsMemory(MemoryUsage value) { mappingsMemory = value; }
+
+    void computeLayeredLayout(
+        TimedResult<std::vector<float>>& result,
+        std::string placement,
+        std::string layering,
+        int crossingsTimeBudget,
+        int restartsCount,
+        std::function<void(double)> onProgress);
+
+    void computeFreeseLayout(
+        IterativeTimedResult<std::vector<float>>& result,
+        ConvergenceCriteria convergenceCriteria,
+        const std::optional<WarmStart>& warmStart,
+        std::function<void(double)> onProgress);
+
+    void computeReDrawLayout(
+        IterativeTimedResult<std::vector<float>>& result,
+        unsigned int seed,
+        int targetDimension,
+        bool parallelize,
+        ConvergenceCriteria convergenceCriteria,
+        const std::optional<WarmStart>& warmStart,
+        std::function<void(double)> onProgress);
+
+    void computeMultilevelLayout(
+        IterativeTimedResult<std::vector<float>>& result,
+        std::string engine,
+        unsigned int seed,
+        int targetDimension,
+        bool parallelize,
+        ConvergenceCriteria convergenceCriteria,
+        std::function<void(double)> onProgress);
+
+private:
+    int supremum;
+    int infimum;
+    int conceptsCount;
+    std::vector<std::unordered_set<int>> subconceptsMapping;
+    std::vector<std::unordered_set<int>> superconceptsMapping;
+    MemoryUsage mappingsMemory;
+
+    /// @brief Layers mapping and layers of each used layering.
+    std::unordered_map<std::string, std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>>> layers;
+    std::unique_ptr<OrderedLayersCache> orderedLayers;
+    /// @brief Ranks and rank counts of the Freese layout.
+    std::unique_ptr<std::tuple<std::vector<int>, std::unordered_map<int, int>>> ranks;
+    /// @brief Topological order of the ReDraw layout.
+    std::unique_ptr<std::vector<int>> topologicalOrder;
+};
+
+#endif
\ No newline at end of file
@@ -1,8 +1,14 @@
 #include "../types/TimedResult.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
 #include "../utils.h"
+#include "../memory.h"
 #include "layered/layeredLayout.h"
 #include "freeseLayout.h"
 #include "reDrawLayout.h"
+#include "multilevelLayout.h"
+#include "layoutSession.h"
+#include "warmStart.h"
 #include "layouts.h"
 
 #include <emscripten/emscripten.h>
@@ -10,20 +16,38 @@
 #include <stdio.h>
 #include <vector>
 #include <memory>
+#include <optional>
 #include <unordered_set>
 
-std::unique_ptr<std::vector<int>> jsTypedArrayToVector(const emscripten::val& intArray) {
-    auto vec = std::make_unique<std::vector<int>>();
+template <typename T = int>
+std::unique_ptr<std::vector<T>> jsTypedArrayToVector(const emscripten::val& typedArray) {
+    auto vec = std::make_unique<std::vector<T>>();
 
-    unsigned int length = intArray["length"].as<unsigned int>();
+    unsigned int length = typedArray["length"].as<unsigned int>();
     vec->resize(length);
     auto memory = emscripten::val::module_property("HEAPU8")["buffer"];
-    auto memoryView = intArray["constructor"].new_(memory, reinterpret_cast<uintptr_t>(vec->data()), length);
-    memoryView.call<void>("set", intArray);
+    auto memoryView = typedArray["constructor"].new_(memory, reinterpret_cast<uintptr_t>(vec->data()), length);
+    memoryView.call<void>("set", typedArray);
 
     return vec;
 }
 
+std::optional<WarmStart> convertToWarmStart(
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
+) {
+    if (previousLayoutTypedArray.isUndefined() || previousLayoutTypedArray.isNull() ||
+        newIndexesTypedArray.isUndefined() || newIndexesTypedArray.isNull()) {
+        return std::nullopt;
+    }
+
+    WarmStart warmStart;
+    warmStart.previousLayout = std::move(*jsTypedArrayToVector<float>(previousLayoutTypedArray));
+    warmStart.newIndexes = std::move(*jsTypedArrayToVector<int>(newIndexesTypedArray));
+
+    return warmStart;
+}
+
 std::unique_ptr<std::tuple<
     std::vector<std::unordered_set<int>>,
     std::vector<std::unordered_set<int>>
@@ -67,7 +91,10 @@ void computeLayeredLayoutJs(
     int supremum,
     int conceptsCount,
     const emscripten::val& subconceptsMappingTypedArray,
-    std::string placement
+    std::string placement,
+    std::string layering,
+    int crossingsTimeBudget,
+    int restartsCount
 #ifdef __EMSCRIPTEN__
     , OnProgressCallback onProgress
 #endif
@@ -90,21 +117,28 @@ void computeLayeredLayoutJs(
         subconceptsMapping,
         superconceptsMapping,
         placement,
+        layering,
+        crossingsTimeBudget,
+        restartsCount,
         onProgressCallback);
 }
 
 void computeFreeseLayoutJs(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
-    const emscripten::val& subconceptsMappingTypedArray
+    const emscripten::val& subconceptsMappingTypedArray,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
 #ifdef __EMSCRIPTEN__
     , OnProgressCallback onProgress
 #endif
 ) {
     auto mappings = convertToCppMappings(conceptsCount, subconceptsMappingTypedArray);
     auto& [subconceptsMapping, superconceptsMapping] = *mappings;
+    auto warmStart = convertToWarmStart(previousLayoutTypedArray, newIndexesTypedArray);
 
     auto onProgressCallback = [&onProgress](double value) {
 #ifdef __EMSCRIPTEN__
@@ -121,24 +155,30 @@ void computeFreeseLayoutJs(
         conceptsCount,
         subconceptsMapping,
         superconceptsMapping,
+        convergenceCriteria,
+        warmStart,
         onProgressCallback);
 }
 
 void computeReDrawLayoutJs(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
     const emscripten::val& subconceptsMappingTypedArray,
     unsigned int seed,
     int targetDimension,
-    bool parallelize
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
 #ifdef __EMSCRIPTEN__
     , OnProgressCallback onProgress
 #endif
 ) {
     auto mappings = convertToCppMappings(conceptsCount, subconceptsMappingTypedArray);
     auto& [subconceptsMapping, superconceptsMapping] = *mappings;
+    auto warmStart = convertToWarmStart(previousLayoutTypedArray, newIndexesTypedArray);
 
     auto onProgressCallback = [&onProgress](double value) {
 #ifdef __EMSCRIPTEN__
@@ -158,5 +198,189 @@ void computeReDrawLayoutJs(
         seed,
         targetDimension,
         parallelize,
+        convergenceCriteria,
+        warmStart,
+        onProgressCallback);
+}
+
+void computeMultilevelLayoutJs(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    const emscripten::val& subconceptsMappingTypedArray,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    auto mappings = convertToCppMappings(conceptsCount, subconceptsMappingTypedArray);
+    auto& [subconceptsMapping, superconceptsMapping] = *mappings;
+
+    auto onProgressCallback = [&onProgress](double value) {
+#ifdef __EMSCRIPTEN__
+        if (!onProgress.isUndefined()) {
+            onProgress(value);
+        }
+#endif
+    };
+
+    computeMultilevelLayout(
+        result,
+        supremum,
+        infimum,
+        conceptsCount,
+        subconceptsMapping,
+        superconceptsMapping,
+        engine,
+        seed,
+        targetDimension,
+        parallelize,
+        convergenceCriteria,
+        onProgressCallback);
+}
+
+LayoutSession* createLayoutSessionJs(
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    const emscripten::val& subconceptsMappingTypedArray
+) {
+    MemoryTracker memoryTracker;
+
+    auto mappings = convertToCppMappings(conceptsCount, subconceptsMappingTypedArray);
+    auto& [subconceptsMapping, superconceptsMapping] = *mappings;
+
+    auto session = new LayoutSession(
+        supremum,
+        infimum,
+        conceptsCount,
+        std::move(subconceptsMapping),
+        std::move(superconceptsMapping));
+
+    session->setMappingsMemory(memoryTracker.finish());
+
+    return session;
+}
+
+void computeSessionLayeredLayoutJs(
+    LayoutSession& session,
+    TimedResult<std::vector<float>>& result,
+    std::string placement,
+    std::string layering,
+    int crossingsTimeBudget,
+    int restartsCount
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    auto onProgressCallback = [&onProgress](double value) {
+#ifdef __EMSCRIPTEN__
+        if (!onProgress.isUndefined()) {
+            onProgress(value);
+        }
+#endif
+    };
+
+    session.computeLayeredLayout(
+        result,
+        placement,
+        layering,
+        crossingsTimeBudget,
+        restartsCount,
+        onProgressCallback);
+}
+
+void computeSessionFreeseLayoutJs(
+    LayoutSession& session,
+    IterativeTimedResult<std::vector<float>>& result,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    auto warmStart = convertToWarmStart(previousLayoutTypedArray, newIndexesTypedArray);
+
+    auto onProgressCallback = [&onProgress](double value) {
+#ifdef __EMSCRIPTEN__
+        if (!onProgress.isUndefined()) {
+            onProgress(value);
+        }
+#endif
+    };
+
+    session.computeFreeseLayout(
+        result,
+        convergenceCriteria,
+        warmStart,
+        onProgressCallback);
+}
+
+void computeSessionReDrawLayoutJs(
+    LayoutSession& session,
+    IterativeTimedResult<std::vector<float>>& result,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    auto warmStart = convertToWarmStart(previousLayoutTypedArray, newIndexesTypedArray);
+
+    auto onProgressCallback = [&onProgress](double value) {
+#ifdef __EMSCRIPTEN__
+        if (!onProgress.isUndefined()) {
+            onProgress(value);
+        }
+#endif
+    };
+
+    session.computeReDrawLayout(
+        result,
+        seed,
+        targetDimension,
+        parallelize,
+        convergenceCriteria,
+        warmStart,
+        onProgressCallback);
+}
+
+void computeSessionMultilevelLayoutJs(
+    LayoutSession& session,
+    IterativeTimedResult<std::vector<float>>& result,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+) {
+    auto onProgressCallback = [&onProgress](double value) {
+#ifdef __EMSCRIPTEN__
+        if (!onProgress.isUndefined()) {
+            onProgress(value);
+        }
+#endif
+    };
+
+    session.computeMultilevelLayout(
+        result,
+        engine,
+        seed,
+        targetDimension,
+        parallelize,
+        convergenceCriteria,
         onProgressCallback);
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include <vector>
 #include <emscripten/val.h>
 #include "../types/TimedResult.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+#include "layoutSession.h"
 
 #ifdef __EMSCRIPTEN__
 #include "../types/OnProgressCallback.h"
@@ -14,32 +17,118 @@ void computeLayeredLayoutJs(
     int supremum,
     int conceptsCount,
     emscripten::val const & superconceptsMappingTypedArray,
-    std::string placement
+    std::string placement,
+    std::string layering,
+    int crossingsTimeBudget,
+    int restartsCount
 #ifdef __EMSCRIPTEN__
     , OnProgressCallback onProgress
 #endif
 );
 
 void computeFreeseLayoutJs(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
-    const emscripten::val& subconceptsMappingTypedArray
+    const emscripten::val& subconceptsMappingTypedArray,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
 #ifdef __EMSCRIPTEN__
     , OnProgressCallback onProgress
 #endif
 );
 
 void computeReDrawLayoutJs(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
     const emscripten::val& subconceptsMappingTypedArray,
     unsigned int seed,
     int targetDimension,
-    bool parallelize
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+);
+
+void computeMultilevelLayoutJs(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    const emscripten::val& subconceptsMappingTypedArray,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+);
+
+/**
+ * Creates a session that holds the cover relation of a lattice and computes multiple layouts of it
+ * without converting the mappings again. The session has to be deleted from JavaScript.
+ */
+LayoutSession* createLayoutSessionJs(
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    const emscripten::val& subconceptsMappingTypedArray
+);
+
+void computeSessionLayeredLayoutJs(
+    LayoutSession& session,
+    TimedResult<std::vector<float>>& result,
+    std::string placement,
+    std::string layering,
+    int crossingsTimeBudget,
+    int restartsCount
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+);
+
+void computeSessionFreeseLayoutJs(
+    LayoutSession& session,
+    IterativeTimedResult<std::vector<float>>& result,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+);
+
+void computeSessionReDrawLayoutJs(
+    LayoutSession& session,
+    IterativeTimedResult<std::vector<float>>& result,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const emscripten::val& previousLayoutTypedArray,
+    const emscripten::val& newIndexesTypedArray
+#ifdef __EMSCRIPTEN__
+    , OnProgressCallback onProgress
+#endif
+);
+
+void computeSessionMultilevelLayoutJs(
+    LayoutSession& session,
+    IterativeTimedResult<std::vector<float>>& result,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria
 #ifdef __EMSCRIPTEN__
     , OnProgressCallback onProgress
 #endif
@@ -0,0 +1,772 @@
+// Multilevel layout inspired by:
+// - C. Walshaw, "A Multilevel Algorithm for Force-Directed Graph-Drawing"
+// - Y. Hu, "Efficient and High Quality Force-Directed Graph Drawing"
+
+#include "../utils.h"
+#include "../memory.h"
+#include "../trace.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+#include "../types/ProgressData.h"
+#include "utils.h"
+#include "freeseLayout.h"
+#include "reDrawLayout.h"
+#include "multilevelLayout.h"
+
+#define _USE_MATH_DEFINES
+
+#include <cmath>
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <optional>
+#include <string>
+#include <limits>
+
+// ReDraw needs more time per concept than Freese, so it gets a coarser graph
+#define MULTILEVEL_COARSEST_CONCEPTS_COUNT_FREESE 200
+#define MULTILEVEL_COARSEST_CONCEPTS_COUNT_REDRAW 100
+// ReDraw checks every pair of edges for crossings, so coarsening also continues until the coarsest graph has few edges
+#define MULTILEVEL_COARSEST_EDGES_COUNT_REDRAW 500
+// Coarsening stops when a level removes less than this fraction of the nodes
+#define MULTILEVEL_MIN_COARSENING_RATIO 0.05
+// Maximum number of neighbors of a neighbor that are examined when looking for a similar concept
+#define MULTILEVEL_MAX_CANDIDATES_COUNT 64
+#define MULTILEVEL_REFINEMENT_ITERATIONS_COUNT 10
+// Weight of the prolonged position in a refinement step, the rest goes to the barycenter of the neighbors
+#define MULTILEVEL_ANCHOR_WEIGHT 0.5
+#define MULTILEVEL_PROGRESS_BLOCKS 3
+
+/** Cover graph of one level of detail. */
+struct MultilevelGraph {
+    CompactMapping subconcepts;
+    CompactMapping superconcepts;
+    int supremum;
+    int infimum;
+    /** Longest path layer of each node from the top. */
+    std::vector<int> layers;
+    int layersCount;
+};
+
+/** Relation between a graph and its coarser graph. */
+struct MultilevelLevel {
+    /** Node of the coarser graph that each node of the finer graph is collapsed to. */
+    std::vector<int> clusters;
+    /** Node of the same layer that each node is collapsed with, -1 if there is none. */
+    std::vector<int> siblings;
+};
+
+void assignMultilevelLayers(MultilevelGraph& graph) {
+    graph.layers = computeLongestPathLayers(graph.supremum, graph.subconcepts);
+    graph.layersCount = *std::max_element(graph.layers.begin(), graph.layers.end()) + 1;
+}
+
+int countNeighbors(CompactMapping& mapping, int node) {
+    return mapping.offsets[node + 1] - mapping.offsets[node];
+}
+
+/**
+ * Returns the node of the same layer that shares the most neighbors with the node relative to their numbers of neighbors.
+ *
+ * The neighbors of each neighbor are scanned from a cursor that skips the already matched nodes,
+ * so high degree nodes are not scanned from the beginning over and over.
+ */
+int findSimilarNode(
+    MultilevelGraph& graph,
+    int node,
+    std::vector<int>& matches,
+    std::vector<int>& sharedCounts,
+    std::vector<int>& touchedNodes,
+    std::vector<int>& subconceptsCursors,
+    std::vector<int>& superconceptsCursors
+) {
+    auto isCandidate = [&](int candidate) {
+        return candidate != node &&
+            matches[candidate] == -1 &&
+            candidate != graph.supremum &&
+            candidate != graph.infimum &&
+            graph.layers[candidate] == graph.layers[node];
+    };
+
+    auto collectCandidates = [&](CompactMapping& neighbors, CompactMapping& neighborsOfNeighbors, std::vector<int>& cursors) {
+        for (int i = neighbors.offsets[node]; i < neighbors.offsets[node + 1]; i++) {
+            int neighbor = neighbors.nodes[i];
+            int& cursor = cursors[neighbor];
+            int end = neighborsOfNeighbors.offsets[neighbor + 1];
+
+            while (cursor < end && matches[neighborsOfNeighbors.nodes[cursor]] != -1) {
+                cursor++;
+            }
+
+            int scanEnd = std::min(end, cursor + MULTILEVEL_MAX_CANDIDATES_COUNT);
+
+            for (int j = cursor; j < scanEnd; j++) {
+                int candidate = neighborsOfNeighbors.nodes[j];
+
+                if (!isCandidate(candidate)) {
+                    continue;
+                }
+                if (sharedCounts[candidate] == 0) {
+                    touchedNodes.push_back(candidate);
+                }
+
+                sharedCounts[candidate]++;
+            }
+        }
+    };
+
+    collectCandidates(graph.superconcepts, graph.subconcepts, subconceptsCursors);
+    collectCandidates(graph.subconcepts, graph.superconcepts, superconceptsCursors);
+
+    int nodeNeighborsCount = countNeighbors(graph.subconcepts, node) + countNeighbors(graph.superconcepts, node);
+    int similarNode = -1;
+    double bestSimilarity = 0;
+
+    for (int candidate : touchedNodes) {
+        int candidateNeighborsCount = countNeighbors(graph.subconcepts, candidate) + countNeighbors(graph.superconcepts, candidate);
+        int shared = sharedCounts[candidate];
+        // Jaccard similarity of the neighborhoods
+        double similarity = (double)shared / (nodeNeighborsCount + candidateNeighborsCount - shared);
+
+        if (similarity > bestSimilarity || (similarity == bestSimilarity && candidate < similarNode)) {
+            bestSimilarity = similarity;
+            similarNode = candidate;
+        }
+
+        sharedCounts[candidate] = 0;
+    }
+
+    touchedNodes.clear();
+
+    return similarNode;
+}
+
+/**
+ * Collapses pairs of nodes of the graph to single nodes of the coarser graph.
+ *
+ * A pair is either a chain edge, whose upper node has no other subconcept and whose lower node has no other superconcept,
+ * or two similar nodes of the same layer. Collapsing such pairs never creates a cycle:
+ * every path leaves a pair from a node that is not above the node the path entered the pair through,
+ * so the layers strictly increase along any cycle of the coarser graph.
+ *
+ * @return Number of nodes of the coarser graph
+ */
+int matchNodes(MultilevelGraph& graph, MultilevelLevel& level) {
+    int nodesCount = graph.layers.size();
+    std::vector<int> matches(nodesCount, -1);
+    std::vector<int> sharedCounts(nodesCount, 0);
+    std::vector<int> touchedNodes;
+    std::vector<int> subconceptsCursors(graph.subconcepts.offsets.begin(), graph.subconcepts.offsets.end() - 1);
+    std::vector<int> superconceptsCursors(graph.superconcepts.offsets.begin(), graph.superconcepts.offsets.end() - 1);
+
+    level.siblings.assign(nodesCount, -1);
+
+    auto isSingleChainEdge = [&](int upper, int lower) {
+        return countNeighbors(graph.subconcepts, upper) == 1 &&
+            countNeighbors(graph.superconcepts, lower) == 1 &&
+            matches[upper] == -1 &&
+            matches[lower] == -1 &&
+            upper != graph.supremum &&
+            lower != graph.infimum;
+    };
+
+    auto match = [&](int first, int second) {
+        matches[first] = second;
+        matches[second] = first;
+    };
+
+    for (int node = 0; node < nodesCount; node++) {
+        if (matches[node] != -1 || node == graph.supremum || node == graph.infimum) {
+            continue;
+        }
+
+        if (countNeighbors(graph.subconcepts, node) == 1) {
+            int subconcept = graph.subconcepts.nodes[graph.subconcepts.offsets[node]];
+
+            if (isSingleChainEdge(node, subconcept)) {
+                match(node, subconcept);
+                continue;
+            }
+        }
+        if (countNeighbors(graph.superconcepts, node) == 1) {
+            int superconcept = graph.superconcepts.nodes[graph.superconcepts.offsets[node]];
+
+            if (isSingleChainEdge(superconcept, node)) {
+                match(superconcept, node);
+                continue;
+            }
+        }
+
+        int similarNode = findSimilarNode(graph, node, matches, sharedCounts, touchedNodes, subconceptsCursors, superconceptsCursors);
+
+        if (similarNode != -1) {
+            match(node, similarNode);
+            level.siblings[node] = similarNode;
+            level.siblings[similarNode] = node;
+        }
+    }
+
+    level.clusters.assign(nodesCount, -1);
+    int clustersCount = 0;
+
+    for (int node = 0; node < nodesCount; node++) {
+        if (level.clusters[node] != -1) {
+            continue;
+        }
+
+        level.clusters[node] = clustersCount;
+
+        if (matches[node] != -1) {
+            level.clusters[matches[node]] = clustersCount;
+        }
+
+        clustersCount++;
+    }
+
+    return clustersCount;
+}
+
+/**
+ * Creates the mapping of the coarser graph, edges inside the collapsed pairs are removed.
+ */
+CompactMapping createCoarseMapping(
+    CompactMapping& mapping,
+    std::vector<int>& clusters,
+    std::vector<int>& clusterOffsets,
+    std::vector<int>& clusterMembers
+) {
+    int clustersCount = clusterOffsets.size() - 1;
+    CompactMapping coarseMapping;
+    // Last cluster whose neighbors contain the cluster, used to skip duplicate edges
+    std::vector<int> lastNeighborOf(clustersCount, -1);
+
+    coarseMapping.offsets.reserve(clustersCount + 1);
+    coarseMapping.offsets.push_back(0);
+
+    for (int cluster = 0; cluster < clustersCount; cluster++) {
+        for (int i = clusterOffsets[cluster]; i < clusterOffsets[cluster + 1]; i++) {
+            int node = clusterMembers[i];
+
+            for (int j = mapping.offsets[node]; j < mapping.offsets[node + 1]; j++) {
+                int neighborCluster = clusters[mapping.nodes[j]];
+
+                if (neighborCluster != cluster && lastNeighborOf[neighborCluster] != cluster) {
+                    lastNeighborOf[neighborCluster] = cluster;
+                    coarseMapping.nodes.push_back(neighborCluster);
+                }
+            }
+        }
+
+        coarseMapping.offsets.push_back(coarseMapping.nodes.size());
+    }
+
+    return coarseMapping;
+}
+
+void coarsenGraph(
+    MultilevelGraph& graph,
+    MultilevelLevel& level,
+    MultilevelGraph& coarseGraph
+) {
+    int nodesCount = graph.layers.size();
+    int clustersCount = matchNodes(graph, level);
+
+    // Members of each cluster sorted by the cluster
+    std::vector<int> clusterOffsets(clustersCount + 1, 0);
+    std::vector<int> clusterMembers(nodesCount);
+
+    for (int node = 0; node < nodesCount; node++) {
+        clusterOffsets[level.clusters[node] + 1]++;
+    }
+    for (int cluster = 0; cluster < clustersCount; cluster++) {
+        clusterOffsets[cluster + 1] += clusterOffsets[cluster];
+    }
+    {
+        std::vector<int> nextPositions(clusterOffsets.begin(), clusterOffsets.end() - 1);
+
+        for (int node = 0; node < nodesCount; node++) {
+            clusterMembers[nextPositions[level.clusters[node]]++] = node;
+        }
+    }
+
+    coarseGraph.subconcepts = createCoarseMapping(graph.subconcepts, level.clusters, clusterOffsets, clusterMembers);
+    coarseGraph.superconcepts = createCoarseMapping(graph.superconcepts, level.clusters, clusterOffsets, clusterMembers);
+    coarseGraph.supremum = level.clusters[graph.supremum];
+    coarseGraph.infimum = level.clusters[graph.infimum];
+
+    assignMultilevelLayers(coarseGraph);
+}
+
+std::vector<std::unordered_set<int>> createMappingFromCompact(CompactMapping& mapping) {
+    int nodesCount = mapping.offsets.size() - 1;
+    std::vector<std::unordered_set<int>> result(nodesCount);
+
+    for (int node = 0; node < nodesCount; node++) {
+        result[node].insert(mapping.nodes.begin() + mapping.offsets[node], mapping.nodes.begin() + mapping.offsets[node + 1]);
+    }
+
+    return result;
+}
+
+/**
+ * Removes the edges that are implied by a longer path.
+ * Collapsing concepts creates many such edges and they only slow ReDraw down.
+ */
+void removeTransitiveEdges(
+    MultilevelGraph& graph,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+) {
+    int nodesCount = graph.layers.size();
+    std::vector<int> nodes(nodesCount);
+    std::iota(nodes.begin(), nodes.end(), 0);
+    // Subconcepts are always in a lower layer, so they are processed first
+    std::sort(nodes.begin(), nodes.end(), [&graph](int first, int second) { return graph.layers[first] > graph.layers[second]; });
+
+    // Nodes reachable from each node by a downward path
+    std::vector<std::vector<bool>> reachable(nodesCount, std::vector<bool>(nodesCount, false));
+
+    for (int node : nodes) {
+        auto& nodeReachable = reachable[node];
+
+        for (int subconcept : subconceptsMapping[node]) {
+            auto& subconceptReachable = reachable[subconcept];
+
+            for (int other = 0; other < nodesCount; other++) {
+                if (subconceptReachable[other]) {
+                    nodeReachable[other] = true;
+                }
+            }
+        }
+
+        std::vector<int> transitiveSubconcepts;
+
+        for (int subconcept : subconceptsMapping[node]) {
+            if (nodeReachable[subconcept]) {
+                transitiveSubconcepts.push_back(subconcept);
+            }
+        }
+
+        for (int subconcept : transitiveSubconcepts) {
+            subconceptsMapping[node].erase(subconcept);
+            superconceptsMapping[subconcept].erase(node);
+        }
+
+        for (int subconcept : subconceptsMapping[node]) {
+            nodeReachable[subconcept] = true;
+        }
+    }
+}
+
+/**
+ * Computes the layout of the coarsest graph by the selected engine.
+ * @return Horizontal positions (x and z) and vertical positions of the nodes
+ */
+void computeCoarsestLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    MultilevelGraph& graph,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    std::function<void(double)> onProgress,
+    std::vector<float>& positions,
+    std::vector<float>& verticalPositions
+) {
+    int nodesCount = graph.layers.size();
+    auto subconceptsMapping = createMappingFromCompact(graph.subconcepts);
+    auto superconceptsMapping = createMappingFromCompact(graph.superconcepts);
+    IterativeTimedResult<std::vector<float>> coarsestResult;
+
+    if (engine == "redraw") {
+        removeTransitiveEdges(graph, subconceptsMapping, superconceptsMapping);
+        computeReDrawLayout(
+            coarsestResult,
+            graph.supremum,
+            graph.infimum,
+            nodesCount,
+            subconceptsMapping,
+            superconceptsMapping,
+            seed,
+            targetDimension,
+            parallelize,
+            convergenceCriteria,
+            std::nullopt,
+            onProgress);
+    }
+    else {
+        computeFreeseLayout(
+            coarsestResult,
+            graph.supremum,
+            graph.infimum,
+            nodesCount,
+            subconceptsMapping,
+            superconceptsMapping,
+            convergenceCriteria,
+            std::nullopt,
+            onProgress);
+    }
+
+    positions.resize(nodesCount * 2);
+    verticalPositions.resize(nodesCount);
+
+    for (int node = 0; node < nodesCount; node++) {
+        positions[node * 2] = getX(coarsestResult.value, node);
+        positions[node * 2 + 1] = getZ(coarsestResult.value, node);
+        verticalPositions[node] = getY(coarsestResult.value, node);
+    }
+
+    result.iterationsCount = coarsestResult.iterationsCount;
+    result.stopReason = coarsestResult.stopReason;
+}
+
+/**
+ * Places each node of the finer graph to the position of its cluster.
+ * The positions are scaled so that the layers can accommodate more nodes.
+ */
+void prolongPositions(
+    MultilevelGraph& graph,
+    MultilevelGraph& coarseGraph,
+    MultilevelLevel& level,
+    std::vector<float>& coarsePositions,
+    std::vector<float>& positions,
+    bool planar
+) {
+    int nodesCount = graph.layers.size();
+    int coarseNodesCount = coarseGraph.layers.size();
+    // Ratio of the average widths of the layers
+    double widthRatio = ((double)nodesCount / graph.layersCount) / ((double)coarseNodesCount / coarseGraph.layersCount);
+    float scale = planar ? widthRatio : std::sqrt(widthRatio);
+
+    positions.resize(nodesCount * 2);
+
+    for (int node = 0; node < nodesCount; node++) {
+        int cluster = level.clusters[node];
+        positions[node * 2] = scale * coarsePositions[cluster * 2];
+        positions[node * 2 + 1] = scale * coarsePositions[cluster * 2 + 1];
+    }
+}
+
+/**
+ * Computes the horizontal center of the nodes and their root mean square distance from it.
+ */
+double computeRadius(std::vector<float>& positions, double& centerX, double& centerZ) {
+    int nodesCount = positions.size() / 2;
+    centerX = 0;
+    centerZ = 0;
+
+    for (int node = 0; node < nodesCount; node++) {
+        centerX += positions[node * 2];
+        centerZ += positions[node * 2 + 1];
+    }
+
+    centerX /= nodesCount;
+    centerZ /= nodesCount;
+
+    double squaredRadius = 0;
+
+    for (int node = 0; node < nodesCount; node++) {
+        double dx = positions[node * 2] - centerX;
+        double dz = positions[node * 2 + 1] - centerZ;
+        squaredRadius += dx * dx + dz * dz;
+    }
+
+    return std::sqrt(squaredRadius / nodesCount);
+}
+
+/**
+ * Computes the distance that collapsed siblings of each layer should be moved apart to.
+ * The horizontal extent of the layout is divided evenly among the nodes of the layer.
+ */
+std::vector<float> computeSiblingsSpacings(
+    MultilevelGraph& graph,
+    std::vector<float>& positions,
+    bool planar
+) {
+    int nodesCount = graph.layers.size();
+    std::vector<int> layerWidths(graph.layersCount, 0);
+
+    for (int node = 0; node < nodesCount; node++) {
+        layerWidths[graph.layers[node]]++;
+    }
+
+    double centerX, centerZ;
+    double radius = computeRadius(positions, centerX, centerZ);
+    std::vector<float> spacings(graph.layersCount);
+
+    for (int layer = 0; layer < graph.layersCount; layer++) {
+        int width = std::max(layerWidths[layer], 1);
+        // Width of a uniformly filled segment or area of a uniformly filled disk with the same root mean square radius
+        spacings[layer] = planar ?
+            std::sqrt(12.0) * radius / width :
+            radius * std::sqrt(2 * M_PI / width);
+    }
+
+    return spacings;
+}
+
+/**
+ * Moves each node towards the barycenter of its neighbors while keeping it close to its prolonged position,
+ * and moves collapsed siblings apart.
+ * The layout is scaled back to its prolonged extent afterwards, because the barycenters shrink it.
+ */
+void refinePositions(
+    MultilevelGraph& graph,
+    MultilevelLevel& level,
+    std::vector<float>& positions,
+    bool planar
+) {
+    int nodesCount = graph.layers.size();
+    std::vector<float> prolongedPositions = positions;
+    std::vector<float> spacings = computeSiblingsSpacings(graph, positions, planar);
+    double prolongedCenterX, prolongedCenterZ;
+    double prolongedRadius = computeRadius(positions, prolongedCenterX, prolongedCenterZ);
+
+    for (int iteration = 0; iteration < MULTILEVEL_REFINEMENT_ITERATIONS_COUNT; iteration++) {
+        for (int node = 0; node < nodesCount; node++) {
+            float sumX = 0;
+            float sumZ = 0;
+            int count = 0;
+
+            for (CompactMapping* mapping : { &graph.subconcepts, &graph.superconcepts }) {
+                for (int i = mapping->offsets[node]; i < mapping->offsets[node + 1]; i++) {
+                    int neighbor = mapping->nodes[i];
+                    sumX += positions[neighbor * 2];
+                    sumZ += positions[neighbor * 2 + 1];
+                    count++;
+                }
+            }
+
+            if (count == 0) {
+                continue;
+            }
+
+            positions[node * 2] = MULTILEVEL_ANCHOR_WEIGHT * prolongedPositions[node * 2] + (1 - MULTILEVEL_ANCHOR_WEIGHT) * sumX / count;
+            positions[node * 2 + 1] = MULTILEVEL_ANCHOR_WEIGHT * prolongedPositions[node * 2 + 1] + (1 - MULTILEVEL_ANCHOR_WEIGHT) * sumZ / count;
+        }
+
+        for (int node = 0; node < nodesCount; node++) {
+            int sibling = level.siblings[node];
+
+            if (sibling < node) {
+                continue;
+            }
+
+            float dx = positions[node * 2] - positions[sibling * 2];
+            float dz = planar ? 0 : positions[node * 2 + 1] - positions[sibling * 2 + 1];
+            float distance = std::sqrt(dx * dx + dz * dz);
+            float spacing = spacings[graph.layers[node]];
+
+            if (distance >= spacing) {
+                continue;
+            }
+            if (distance < spacing * 1e-3) {
+                // Siblings at the same position are moved apart in a direction given by their index
+                float angle = planar ? 0 : node * 2.39996323;
+                dx = std::cos(angle);
+                dz = std::sin(angle);
+            }
+            else {
+                dx /= distance;
+                dz /= distance;
+            }
+
+            float shift = (spacing - distance) / 2;
+
+            positions[node * 2] += shift * dx;
+            positions[node * 2 + 1] += shift * dz;
+            positions[sibling * 2] -= shift * dx;
+            positions[sibling * 2 + 1] -= shift * dz;
+        }
+    }
+
+    double centerX, centerZ;
+    double radius = computeRadius(positions, centerX, centerZ);
+
+    if (radius == 0) {
+        return;
+    }
+
+    float scale = prolongedRadius / radius;
+
+    for (int node = 0; node < nodesCount; node++) {
+        positions[node * 2] = prolongedCenterX + scale * (positions[node * 2] - centerX);
+        positions[node * 2 + 1] = prolongedCenterZ + scale * (positions[node * 2 + 1] - centerZ);
+    }
+}
+
+/**
+ * Computes the vertical positions of the concepts from their ranks, as in the Freese layout,
+ * mapped linearly so that they best fit the vertical positions of the coarsest layout.
+ */
+void assignVerticalPositions(
+    std::vector<float>& layout,
+    MultilevelGraph& graph,
+    std::vector<int>& coarsestClusters,
+    std::vector<float>& coarsestVerticalPositions
+) {
+    int conceptsCount = graph.layers.size();
+    std::vector<int>& depths = graph.layers;
+    std::vector<int> heights = computeLongestPathLayers(graph.infimum, graph.superconcepts);
+    std::vector<float> ranks(conceptsCount);
+
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        ranks[conceptIndex] = heights[conceptIndex] - depths[conceptIndex];
+    }
+
+    // Least squares fit of the coarsest vertical positions by the ranks of the concepts
+    double sumRanks = 0;
+    double sumPositions = 0;
+
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        sumRanks += ranks[conceptIndex];
+        sumPositions += coarsestVerticalPositions[coarsestClusters[conceptIndex]];
+    }
+
+    double meanRank = sumRanks / conceptsCount;
+    double meanPosition = sumPositions / conceptsCount;
+    double covariance = 0;
+    double variance = 0;
+
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        double rankDifference = ranks[conceptIndex] - meanRank;
+        covariance += rankDifference * (coarsestVerticalPositions[coarsestClusters[conceptIndex]] - meanPosition);
+        variance += rankDifference * rankDifference;
+    }
+
+    double slope = variance == 0 || covariance <= 0 ? 1 : covariance / variance;
+
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        setY(layout, conceptIndex, slope * (ranks[conceptIndex] - meanRank) + meanPosition);
+    }
+}
+
+void computeMultilevelLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    std::function<void(double)> onProgress
+) {
+    TRACE_SCOPE("multilevelLayout");
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    auto progress = ProgressData(MULTILEVEL_PROGRESS_BLOCKS, onProgress);
+    bool planar = engine == "redraw" && targetDimension == 2;
+    int coarsestConceptsCount = engine == "redraw" ?
+        MULTILEVEL_COARSEST_CONCEPTS_COUNT_REDRAW :
+        MULTILEVEL_COARSEST_CONCEPTS_COUNT_FREESE;
+    int coarsestEdgesCount = engine == "redraw" ?
+        MULTILEVEL_COARSEST_EDGES_COUNT_REDRAW :
+        std::numeric_limits<int>::max();
+
+    // The first graph is the input graph, each next graph is a coarser version of the previous one
+    std::vector<MultilevelGraph> graphs(1);
+    std::vector<MultilevelLevel> levels;
+
+    graphs[0].subconcepts = createCompactMapping(subconceptsMapping);
+    graphs[0].superconcepts = createCompactMapping(superconceptsMapping);
+    graphs[0].supremum = supremum;
+    graphs[0].infimum = infimum;
+    assignMultilevelLayers(graphs[0]);
+
+    progress.beginBlock(conceptsCount);
+
+    while (graphs.back().layers.size() > coarsestConceptsCount || graphs.back().subconcepts.nodes.size() > coarsestEdgesCount) {
+        MultilevelGraph coarseGraph;
+        MultilevelLevel level;
+
+        coarsenGraph(graphs.back(), level, coarseGraph);
+
+        int nodesCount = graphs.back().layers.size();
+        int coarseNodesCount = coarseGraph.layers.size();
+
+        if (coarseNodesCount > (1 - MULTILEVEL_MIN_COARSENING_RATIO) * nodesCount) {
+            break;
+        }
+
+        graphs.push_back(std::move(coarseGraph));
+        levels.push_back(std::move(level));
+
+        progress.progress(conceptsCount - coarseNodesCount);
+    }
+
+    progress.finishBlock();
+
+    std::vector<float> positions;
+    std::vector<float> coarsestVerticalPositions;
+
+    // The engine reports the progress within the block by itself
+    progress.beginBlock(1);
+
+    computeCoarsestLayout(
+        result,
+        graphs.back(),
+        engine,
+        seed,
+        targetDimension,
+        parallelize,
+        convergenceCriteria,
+        [&onProgress](double value) { onProgress((1 + value) / MULTILEVEL_PROGRESS_BLOCKS); },
+        positions,
+        coarsestVerticalPositions);
+
+    progress.finishBlock();
+    progress.beginBlock(levels.size());
+
+    std::vector<float> coarsePositions;
+
+    for (int i = levels.size() - 1; i >= 0; i--) {
+        std::swap(positions, coarsePositions);
+        prolongPositions(graphs[i], graphs[i + 1], levels[i], coarsePositions, positions, planar);
+        refinePositions(graphs[i], levels[i], positions, planar);
+
+        progress.progress(levels.size() - i);
+    }
+
+    // Coarsest node of each concept
+    std::vector<int> coarsestClusters(conceptsCount);
+    std::iota(coarsestClusters.begin(), coarsestClusters.end(), 0);
+
+    for (auto& level : levels) {
+        for (int& cluster : coarsestClusters) {
+            cluster = level.clusters[cluster];
+        }
+    }
+
+    result.value.resize(conceptsCount * COORDS_COUNT);
+
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        setX(result.value, conceptIndex, positions[conceptIndex * 2]);
+        setZ(result.value, conceptIndex, planar ? 0 : positions[conceptIndex * 2 + 1]);
+    }
+
+    if (levels.empty()) {
+        // The lattice is small enough to be laid out by the engine directly
+        for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+            setY(result.value, conceptIndex, coarsestVerticalPositions[conceptIndex]);
+        }
+    }
+    else {
+        assignVerticalPositions(result.value, graphs[0], coarsestClusters, coarsestVerticalPositions);
+    }
+
+    // The refinement block has no iterations when the lattice is not coarsened, so the completion is reported unconditionally
+    progress.finishBlocks(1);
+
+    long long endTime = nowMills();
+
+    result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+}
@@ -0,0 +1,35 @@
+#ifndef MULTILEVEL_LAYOUT_H
+#define MULTILEVEL_LAYOUT_H
+
+#include <vector>
+#include <unordered_set>
+#include <functional>
+#include <string>
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+
+/**
+ * Computes a layout of a large lattice in multiple levels of detail.
+ *
+ * The cover graph is repeatedly coarsened by collapsing chains and pairs of similar concepts of the same layer.
+ * The coarsest graph is laid out by the Freese or ReDraw layout (engine is "freese" or "redraw"),
+ * the layout is then prolonged back to the finer graphs and refined by a few local iterations on each level.
+ *
+ * The seed, targetDimension and parallelize parameters are used only by the ReDraw layout.
+ */
+void computeMultilevelLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::string engine,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    std::function<void(double)> onProgress
+);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,494 @@
+// Implementation of Emden R. Gansner, Eleftherios Koutsofios, Stephen C. North and Kiem-Phong Vo, "A Technique for Drawing Directed Graphs"
+// https://graphviz.org/documentation/TSE93.pdf
+
+// Strongly inspired by https://github.com/dagrejs/dagre/blob/master/lib/rank/network-simplex.js
+// and by the incremental updates of https://gitlab.com/graphviz/graphviz/-/blob/main/lib/common/ns.c
+
+#include "layers.h"
+
+#include <vector>
+#include <memory>
+#include <unordered_set>
+#include <algorithm>
+#include <climits>
+
+// Number of tree edges with a negative cut value from which the most negative one leaves the tree
+#define LEAVING_EDGE_SEARCH_SIZE 30
+// Limit of the exchanges similar to nslimit of Graphviz. Every exchange keeps the layering feasible.
+// The longest path layering of a concept lattice is usually close to optimal
+// and most of the remaining exchanges do not change the ranks at all.
+#define NETWORK_SIMPLEX_MAX_ITERATIONS_COUNT 500
+
+struct NetworkSimplexGraph {
+    // Edges go from a superconcept (tail) to a subconcept (head), the head has to be at least one layer lower
+    std::vector<int> edgeTails;
+    std::vector<int> edgeHeads;
+    // Incident edges of each node
+    CompactMapping incidentEdges;
+    std::vector<int> ranks;
+};
+
+struct NetworkSimplexTree {
+    std::vector<bool> isTreeEdge;
+    std::vector<int> treeEdges;
+    // Index of each tree edge in treeEdges
+    std::vector<int> treeEdgeIndexes;
+    // Cut values of the tree edges
+    std::vector<int> cutValues;
+    std::vector<int> parentEdges;
+    // Postorder numbering, a node is a descendant of another if its lim is in the other's [low, lim]
+    std::vector<int> lows;
+    std::vector<int> lims;
+    // Nodes ordered so that every subtree is a contiguous range following its root
+    std::vector<int> preorder;
+    std::vector<int> preorderIndexes;
+    // Buffer of the depth-first search
+    std::vector<int> nextIncidentEdges;
+};
+
+NetworkSimplexGraph createNetworkSimplexGraph(std::vector<std::unordered_set<int>>& subconceptsMapping) {
+    NetworkSimplexGraph graph;
+    int nodesCount = subconceptsMapping.size();
+    std::vector<int> degrees(nodesCount, 0);
+
+    for (int node = 0; node < nodesCount; node++) {
+        for (int subconcept : subconceptsMapping[node]) {
+            graph.edgeTails.push_back(node);
+            graph.edgeHeads.push_back(subconcept);
+            degrees[node]++;
+            degrees[subconcept]++;
+        }
+    }
+
+    auto& offsets = graph.incidentEdges.offsets;
+    offsets.resize(nodesCount + 1, 0);
+
+    for (int node = 0; node < nodesCount; node++) {
+        offsets[node + 1] = offsets[node] + degrees[node];
+    }
+
+    graph.incidentEdges.nodes.resize(offsets[nodesCount]);
+    std::vector<int> filledCounts(nodesCount, 0);
+
+    for (int edge = 0; edge < graph.edgeTails.size(); edge++) {
+        int tail = graph.edgeTails[edge];
+        int head = graph.edgeHeads[edge];
+
+        graph.incidentEdges.nodes[offsets[tail] + filledCounts[tail]++] = edge;
+        graph.incidentEdges.nodes[offsets[head] + filledCounts[head]++] = edge;
+    }
+
+    return graph;
+}
+
+int slack(NetworkSimplexGraph& graph, int edge) {
+    return graph.ranks[graph.edgeHeads[edge]] - graph.ranks[graph.edgeTails[edge]] - 1;
+}
+
+int otherEnd(NetworkSimplexGraph& graph, int edge, int node) {
+    return graph.edgeTails[edge] == node ? graph.edgeHeads[edge] : graph.edgeTails[edge];
+}
+
+void findFeasibleTree(
+    NetworkSimplexGraph& graph,
+    NetworkSimplexTree& tree,
+    int root
+) {
+    int nodesCount = graph.ranks.size();
+    std::vector<bool> isInTree(nodesCount, false);
+    std::vector<int> treeNodes;
+    std::vector<int> stack;
+
+    tree.isTreeEdge.assign(graph.edgeTails.size(), false);
+
+    auto addToTree = [&](int node) {
+        isInTree[node] = true;
+        treeNodes.push_back(node);
+        stack.push_back(node);
+    };
+
+    // Adds all nodes that are reachable from the new tree nodes by tight edges
+    auto expandTree = [&]() {
+        while (!stack.empty()) {
+            int node = stack.back();
+            stack.pop_back();
+
+            for (int i = graph.incidentEdges.offsets[node]; i < graph.incidentEdges.offsets[node + 1]; i++) {
+                int edge = graph.incidentEdges.nodes[i];
+                int other = otherEnd(graph, edge, node);
+
+                if (!isInTree[other] && slack(graph, edge) == 0) {
+                    tree.isTreeEdge[edge] = true;
+                    addToTree(other);
+                }
+            }
+        }
+    };
+
+    addToTree(root);
+    expandTree();
+
+    while (treeNodes.size() < nodesCount) {
+        // Find an edge with the minimal slack that has exactly one end in the tree
+        int minSlackEdge = -1;
+        int minSlack = INT_MAX;
+
+        for (int edge = 0; edge < graph.edgeTails.size(); edge++) {
+            if (isInTree[graph.edgeTails[edge]] != isInTree[graph.edgeHeads[edge]] && slack(graph, edge) < minSlack) {
+                minSlackEdge = edge;
+                minSlack = slack(graph, edge);
+            }
+        }
+
+        if (minSlackEdge == -1) {
+            // The rest of the nodes is not connected to the tree
+            break;
+        }
+
+        // Moving the whole tree makes the edge tight
+        int delta = isInTree[graph.edgeTails[minSlackEdge]] ? minSlack : -minSlack;
+
+        for (int node : treeNodes) {
+            graph.ranks[node] += delta;
+        }
+
+        tree.isTreeEdge[minSlackEdge] = true;
+        addToTree(isInTree[graph.edgeTails[minSlackEdge]] ? graph.edgeHeads[minSlackEdge] : graph.edgeTails[minSlackEdge]);
+        expandTree();
+    }
+}
+
+void assignLowLimValues(
+    NetworkSimplexGraph& graph,
+    NetworkSimplexTree& tree,
+    int subtreeRoot,
+    int parentEdge,
+    int low,
+    int preorderIndex
+) {
+    // Numbers the subtree that is rooted in subtreeRoot, the numbering starts at low
+    std::vector<int> stack;
+    int nextLim = low;
+
+    tree.parentEdges[subtreeRoot] = parentEdge;
+    tree.lows[subtreeRoot] = nextLim;
+    tree.nextIncidentEdges[subtreeRoot] = graph.incidentEdges.offsets[subtreeRoot];
+    tree.preorder[preorderIndex] = subtreeRoot;
+    tree.preorderIndexes[subtreeRoot] = preorderIndex;
+    preorderIndex++;
+    stack.push_back(subtreeRoot);
+
+    while (!stack.empty()) {
+        int node = stack.back();
+        int& i = tree.nextIncidentEdges[node];
+        bool hasDescended = false;
+
+        // Descend to the next child
+        while (i < graph.incidentEdges.offsets[node + 1]) {
+            int edge = graph.incidentEdges.nodes[i];
+            i++;
+
+            if (tree.isTreeEdge[edge] && edge != tree.parentEdges[node]) {
+                int child = otherEnd(graph, edge, node);
+
+                tree.parentEdges[child] = edge;
+                tree.lows[child] = nextLim;
+                tree.nextIncidentEdges[child] = graph.incidentEdges.offsets[child];
+                tree.preorder[preorderIndex] = child;
+                tree.preorderIndexes[child] = preorderIndex;
+                preorderIndex++;
+                stack.push_back(child);
+                hasDescended = true;
+                break;
+            }
+        }
+
+        if (!hasDescended) {
+            tree.lims[node] = nextLim;
+            nextLim++;
+            stack.pop_back();
+        }
+    }
+}
+
+void initTree(
+    NetworkSimplexGraph& graph,
+    NetworkSimplexTree& tree,
+    int root
+) {
+    int nodesCount = graph.ranks.size();
+
+    tree.parentEdges.assign(nodesCount, -1);
+    tree.lows.assign(nodesCount, 0);
+    tree.lims.assign(nodesCount, 0);
+    tree.preorder.assign(nodesCount, 0);
+    tree.preorderIndexes.assign(nodesCount, 0);
+    tree.nextIncidentEdges.assign(nodesCount, 0);
+    tree.cutValues.assign(graph.edgeTails.size(), 0);
+    tree.treeEdgeIndexes.assign(graph.edgeTails.size(), -1);
+    tree.treeEdges.clear();
+
+    for (int edge = 0; edge < graph.edgeTails.size(); edge++) {
+        if (tree.isTreeEdge[edge]) {
+            tree.treeEdgeIndexes[edge] = tree.treeEdges.size();
+            tree.treeEdges.push_back(edge);
+        }
+    }
+
+    assignLowLimValues(graph, tree, root, -1, 1, 0);
+}
+
+void assignCutValues(
+    NetworkSimplexGraph& graph,
+    NetworkSimplexTree& tree
+) {
+    // Children are processed before their parents
+    for (int p = tree.preorder.size() - 1; p > 0; p--) {
+        int child = tree.preorder[p];
+        int parentEdge = tree.parentEdges[child];
+        bool isChildTail = graph.edgeTails[parentEdge] == child;
+        int cutValue = 1;
+
+        for (int i = graph.incidentEdges.offsets[child]; i < graph.incidentEdges.offsets[child + 1]; i++) {
+            int edge = graph.incidentEdges.nodes[i];
+
+            if (edge == parentEdge) {
+                continue;
+            }
+
+            bool isOutEdge = graph.edgeTails[edge] == child;
+            bool pointsToHead = isOutEdge == isChildTail;
+
+            cutValue += pointsToHead ? 1 : -1;
+
+            if (tree.isTreeEdge[edge]) {
+                int otherCutValue = tree.cutValues[edge];
+                cutValue += pointsToHead ? -otherCutValue : otherCutValue;
+            }
+        }
+
+        tree.cutValues[parentEdge] = cutValue;
+    }
+}
+
+bool isDescendant(NetworkSimplexTree& tree, int node, int root) {
+    return tree.lows[root] <= tree.lims[node] && tree.lims[node] <= tree.lims[root];
+}
+
+int childOfTreeEdge(NetworkSimplexGraph& graph, NetworkSimplexTree& tree, int edge) {
+    int tail = graph.edgeTails[edge];
+    int head = graph.edgeHeads[edge];
+
+    return tree.lims[tail] < tree.lims[head] ? tail : head;
+}
+
+int findLeavingEdge(
+    NetworkSimplexTree& tree,
+    int& searchStart
+) {
+    // Tree edges are searched cyclically, so that the search does not always start with the same edges
+    int leavingEdge = -1;
+    int foundCount = 0;
+    int treeEdgesCount = tree.treeEdges.size();
+
+    for (int j = 0; j < treeEdgesCount; j++) {
+        int index = (searchStart + j) % treeEdgesCount;
+        int edge = tree.treeEdges[index];
+
+        if (tree.cutValues[edge] < 0) {
+            if (leavingEdge == -1 || tree.cutValues[edge] < tree.cutValues[leavingEdge]) {
+                leavingEdge = edge;
+            }
+
+            foundCount++;
+
+            if (foundCount >= LEAVING_EDGE_SEARCH_SIZE) {
+                searchStart = index + 1;
+                return leavingEdge;
+            }
+        }
+    }
+
+    searchStart = 0;
+    return leavingEdge;
+}
+
+int findEnteringEdge(
+    NetworkSimplexGraph& graph,
+    NetworkSimplexTree& tree,
+    int leavingEdge
+) {
+    // The leaving edge splits the tree into the subtree of its child and the rest,
+    // the entering edge has to reconnect them in the opposite direction
+    int subtreeRoot = childOfTreeEdge(graph, tree, leavingEdge);
+    bool isSubtreeRootTail = graph.edgeTails[leavingEdge] == subtreeRoot;
+    int subtreeSize = tree.lims[subtreeRoot] - tree.lows[subtreeRoot] + 1;
+    int nodesCount = tree.preorder.size();
+
+    // Only edges incident to the smaller component are searched
+    bool searchSubtree = 2 * subtreeSize <= nodesCount;
+    int subtreeStart = tree.preorderIndexes[subtreeRoot];
+    int subtreeEnd = subtreeStart + subtreeSize;
+
+    int enteringEdge = -1;
+    int minSlack = INT_MAX;
+
+    auto searchNode = [&](int node) {
+        for (int i = graph.incidentEdges.offsets[node]; i < graph.incidentEdges.offsets[node + 1]; i++) {
+            int edge = graph.incidentEdges.nodes[i];
+            bool isTailInSubtree = isDescendant(tree, graph.edgeTails[edge], subtreeRoot);
+            bool isHeadInSubtree = isDescendant(tree, graph.edgeHeads[edge], subtreeRoot);
+
+            if (isTailInSubtree != isSubtreeRootTail &&
+                isHeadInSubtree == isSubtreeRootTail &&
+                slack(graph, edge) < minSlack) {
+                enteringEdge = edge;
+                minSlack = slack(graph, edge);
+            }
+        }
+    };
+
+    if (searchSubtree) {
+        for (int p = subtreeStart; p < subtreeEnd; p++) {
+            searchNode(tree.preorder[p]);
+        }
+    }
+    else {
+        for (int p = 0; p < subtreeStart; p++) {
+            searchNode(tree.preorder[p]);
+        }
+        for (int p = subtreeEnd; p < nodesCount; p++) {
+            searchNode(tree.preorder[p]);
+        }
+    }
+
+    return enteringEdge;
+}
+
+int updateCutValuesOnPath(
+    NetworkSimplexGraph& graph,
+    NetworkSimplexTree& tree,
+    int from,
+    int to,
+    int delta,
+    bool direction
+) {
+    // Walks from the node up to the lowest common ancestor of the two nodes
+    int node = from;
+
+    while (!isDescendant(tree, to, node)) {
+        int edge = tree.parentEdges[node];
+        bool isNodeTail = graph.edgeTails[edge] == node;
+
+        tree.cutValues[edge] += (isNodeTail == direction) ? delta : -delta;
+        node = otherEnd(graph, edge, node);
+    }
+
+    return node;
+}
+
+void exchangeEdges(
+    NetworkSimplexGraph& graph,
+    NetworkSimplexTree& tree,
+    int leavingEdge,
+    int enteringEdge
+) {
+    int subtreeRoot = childOfTreeEdge(graph, tree, leavingEdge);
+    int subtreeSize = tree.lims[subtreeRoot] - tree.lows[subtreeRoot] + 1;
+    int nodesCount = tree.preorder.size();
+
+    // Moving one of the components makes the entering edge tight, the smaller one is moved
+    int enteringSlack = slack(graph, enteringEdge);
+    int subtreeDelta = isDescendant(tree, graph.edgeHeads[enteringEdge], subtreeRoot) ? -enteringSlack : enteringSlack;
+
+    if (enteringSlack != 0) {
+        int subtreeStart = tree.preorderIndexes[subtreeRoot];
+        int subtreeEnd = subtreeStart + subtreeSize;
+
+        if (2 * subtreeSize <= nodesCount) {
+            for (int p = subtreeStart; p < subtreeEnd; p++) {
+                graph.ranks[tree.preorder[p]] += subtreeDelta;
+            }
+        }
+        else {
+            for (int p = 0; p < subtreeStart; p++) {
+                graph.ranks[tree.preorder[p]] -= subtreeDelta;
+            }
+            for (int p = subtreeEnd; p < nodesCount; p++) {
+                graph.ranks[tree.preorder[p]] -= subtreeDelta;
+            }
+        }
+    }
+
+    // Only the cut values on the cycle closed by the entering edge change
+    int delta = tree.cutValues[leavingEdge];
+    int tail = graph.edgeTails[enteringEdge];
+    int head = graph.edgeHeads[enteringEdge];
+    int commonAncestor = updateCutValuesOnPath(graph, tree, tail, head, delta, true);
+    updateCutValuesOnPath(graph, tree, head, tail, delta, false);
+
+    tree.cutValues[enteringEdge] = -delta;
+    tree.cutValues[leavingEdge] = 0;
+
+    tree.isTreeEdge[leavingEdge] = false;
+    tree.isTreeEdge[enteringEdge] = true;
+    tree.treeEdges[tree.treeEdgeIndexes[leavingEdge]] = enteringEdge;
+    tree.treeEdgeIndexes[enteringEdge] = tree.treeEdgeIndexes[leavingEdge];
+    tree.treeEdgeIndexes[leavingEdge] = -1;
+
+    // Only the subtree of the common ancestor changes its shape
+    assignLowLimValues(
+        graph,
+        tree,
+        commonAncestor,
+        tree.parentEdges[commonAncestor],
+        tree.lows[commonAncestor],
+        tree.preorderIndexes[commonAncestor]);
+}
+
+std::unique_ptr<std::tuple<std::vector<int>, std::vector<std::unordered_set<int>>>> assignNodesToLayersByNetworkSimplex(
+    int startConceptIndex,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+) {
+    int nodesCount = subconceptsMapping.size();
+    auto graph = createNetworkSimplexGraph(subconceptsMapping);
+    NetworkSimplexTree tree;
+
+    auto subconcepts = createCompactMapping(subconceptsMapping);
+
+    // Longest path from the top – every node except the top one gets a tight edge to one of its superconcepts
+    graph.ranks = computeLongestPathLayers(startConceptIndex, subconcepts);
+    findFeasibleTree(graph, tree, startConceptIndex);
+    initTree(graph, tree, startConceptIndex);
+    assignCutValues(graph, tree);
+
+    int searchStart = 0;
+
+    for (int iteration = 0; iteration < NETWORK_SIMPLEX_MAX_ITERATIONS_COUNT; iteration++) {
+        // Replacing a tree edge with a negative cut value decreases the total span
+        int leavingEdge = findLeavingEdge(tree, searchStart);
+
+        if (leavingEdge == -1) {
+            break;
+        }
+
+        int enteringEdge = findEnteringEdge(graph, tree, leavingEdge);
+
+        if (enteringEdge == -1) {
+            break;
+        }
+
+        exchangeEdges(graph, tree, leavingEdge, enteringEdge);
+    }
+
+    // Layers are ordered from top to bottom – the start concept is in the top layer
+    std::vector<int> layersMapping(nodesCount);
+    int topRank = *std::min_element(graph.ranks.begin(), graph.ranks.end());
+
+    for (int node = 0; node < nodesCount; node++) {
+        layersMapping[node] = graph.ranks[node] - topRank;
+    }
+
+    return createLayersFromMapping(std::move(layersMapping));
+}
@@ -4,10 +4,15 @@
 // Based on the source code from: https://github.com/domduerr/redraw
 
 #include "../utils.h"
-#include "../types/TimedResult.h"
+#include "../memory.h"
+#include "../trace.h"
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
 #include "../types/ProgressData.h"
 #include "utils.h"
 #include "layers.h"
+#include "convergence.h"
+#include "warmStart.h"
 #include "reDrawLayout.h"
 
 #define _USE_MATH_DEFINES
@@ -20,10 +25,12 @@
 #include <vector>
 #include <algorithm>
 #include <limits>
+#include <optional>
 #include <Eigen/Dense>
 
 #define INITIAL_DIMENSION 5
 #define ITERATIONS_COUNT 1000
+#define WARM_START_ITERATIONS_COUNT 200
 #define C_VERT 1
 #define C_HOR 5
 #define C_PAR 0.005
@@ -157,6 +164,8 @@ void addForce(
     int dimension,
     int index
 ) {
+    TRACE_COUNTER("reDrawLayout.forceEvaluations", 1);
+
     int start = getStart(dimension, index);
 
     for (int i = 0; i < dimension; i++) {
@@ -170,6 +179,8 @@ void addVForce(
     int dimension,
     int index
 ) {
+    TRACE_COUNTER("reDrawLayout.forceEvaluations", 1);
+
     forces[getStart(dimension, index)] += force;
 }
 
@@ -179,6 +190,8 @@ void addHForce(
     int dimension,
     int index
 ) {
+    TRACE_COUNTER("reDrawLayout.forceEvaluations", 1);
+
     int start = getStart(dimension, index);
 
     for (int i = 0; i < dimension - 1; i++) {
@@ -186,25 +199,34 @@ void addHForce(
     }
 }
 
-float applyForces(
+Displacement applyForces(
     std::vector<float>& layout,
     std::vector<float>& forces,
     int conceptsCount,
     int dimension,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
-    std::vector<std::unordered_set<int>>& superconceptsMapping
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<bool>& movableConcepts
 ) {
-    float forcesSum = 0;
+    Displacement displacement = { 0, 0 };
 
     for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        if (!movableConcepts[conceptIndex]) {
+            continue;
+        }
+
         int start = getStart(dimension, conceptIndex);
         float tempY = layout[start];
+        float squaredLength = 0;
 
         for (int i = 0; i < dimension; i++) {
             layout[start + i] += forces[start + i];
-            forcesSum += std::abs(forces[start + i]);
+            displacement.total += std::abs(forces[start + i]);
+            squaredLength += forces[start + i] * forces[start + i];
         }
 
+        displacement.max = std::max(displacement.max, std::sqrt(squaredLength));
+
         if (forces[start] > 0) {
             float upperb = std::numeric_limits<float>::max();
             bool hasPredecessor = false;
@@ -239,7 +261,7 @@ float applyForces(
         }
     }
 
-    return forcesSum;
+    return displacement;
 }
 
 void correctOffset(
@@ -270,13 +292,14 @@ void correctOffset(
     }
 }
 
-float nodeStep(
+Displacement nodeStep(
     std::vector<float>& layout,
     std::vector<float>& forces,
     int conceptsCount,
     int dimension,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
-    std::vector<std::unordered_set<int>>& superconceptsMapping
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<bool>& movableConcepts
 ) {
     for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
         // Vertical forces
@@ -331,7 +354,7 @@ float nodeStep(
         }
     }
 
-    return applyForces(layout, forces, conceptsCount, dimension, subconceptsMapping, superconceptsMapping);
+    return applyForces(layout, forces, conceptsCount, dimension, subconceptsMapping, superconceptsMapping, movableConcepts);
 }
 
 void multiNodeStep(
@@ -341,24 +364,29 @@ void multiNodeStep(
     int dimension,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<bool>& movableConcepts,
+    int iterationsCount,
+    ConvergenceTracker& convergence,
     ProgressData& progress
 ) {
-    progress.beginBlock(ITERATIONS_COUNT);
+    progress.beginBlock(iterationsCount);
+    convergence.beginLoop();
 
-    for (int i = 0; i < ITERATIONS_COUNT; i++) {
+    for (int i = 0; i < iterationsCount && convergence.canContinue(); i++) {
         resetForces(forces, conceptsCount, dimension);
 
-        float totalForce = nodeStep(
+        auto displacement = nodeStep(
             layout,
             forces,
             conceptsCount,
             dimension,
             subconceptsMapping,
-            superconceptsMapping);
+            superconceptsMapping,
+            movableConcepts);
 
         progress.progress(i + 1);
 
-        if (totalForce < EPSILON) {
+        if (convergence.step(displacement, EPSILON)) {
             break;
         }
     }
@@ -397,13 +425,14 @@ std::vector<float> calculateLineForce(
     return result;
 }
 
-float lineStep(
+Displacement lineStep(
     std::vector<float>& layout,
     std::vector<float>& forces,
     int conceptsCount,
     int dimension,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
-    std::vector<std::unordered_set<int>>& superconceptsMapping
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<bool>& movableConcepts
 ) {
     // TODO: Check if this is implemented correctly
     for (int firstFrom = 0; firstFrom < conceptsCount; firstFrom++) {
@@ -476,7 +505,7 @@ float lineStep(
         }
     }
 
-    return applyForces(layout, forces, conceptsCount, dimension, subconceptsMapping, superconceptsMapping);
+    return applyForces(layout, forces, conceptsCount, dimension, subconceptsMapping, superconceptsMapping, movableConcepts);
 }
 
 void multiLineStep(
@@ -486,24 +515,29 @@ void multiLineStep(
     int dimension,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
+    std::vector<bool>& movableConcepts,
+    int iterationsCount,
+    ConvergenceTracker& convergence,
     ProgressData& progress
 ) {
-    progress.beginBlock(ITERATIONS_COUNT);
+    progress.beginBlock(iterationsCount);
+    convergence.beginLoop();
 
-    for (int i = 0; i < ITERATIONS_COUNT; i++) {
+    for (int i = 0; i < iterationsCount && convergence.canContinue(); i++) {
         resetForces(forces, conceptsCount, dimension);
 
-        float totalForce = lineStep(
+        auto displacement = lineStep(
             layout,
             forces,
             conceptsCount,
             dimension,
             subconceptsMapping,
-            superconceptsMapping);
+            superconceptsMapping,
+            movableConcepts);
 
         progress.progress(i + 1);
 
-        if (totalForce < EPSILON) {
+        if (convergence.step(displacement, EPSILON)) {
             break;
         }
     }
@@ -519,8 +553,13 @@ void round(
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
     bool parallelize,
+    std::vector<bool>& movableConcepts,
+    int iterationsCount,
+    ConvergenceTracker& convergence,
     ProgressData& progress
 ) {
+    TRACE_SCOPE("reDrawLayout.round");
+
     multiNodeStep(
         layout,
         forces,
@@ -528,6 +567,9 @@ void round(
         dimension,
         subconceptsMapping,
         superconceptsMapping,
+        movableConcepts,
+        iterationsCount,
+        convergence,
         progress);
     correctOffset(layout, conceptsCount, dimension);
 
@@ -539,6 +581,9 @@ void round(
             dimension,
             subconceptsMapping,
             superconceptsMapping,
+            movableConcepts,
+            iterationsCount,
+            convergence,
             progress);
         correctOffset(layout, conceptsCount, dimension);
     }
@@ -548,8 +593,7 @@ void initializeLayout(
     std::vector<float>& layout,
     int conceptsCount,
     int dimension,
-    int infimum,
-    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    const std::vector<int>& topologicalOrder,
     unsigned int seed
 ) {
     layout.resize(getLayoutDimension(dimension) * conceptsCount);
@@ -559,11 +603,9 @@ void initializeLayout(
     // Uniform distribution for numbers between -0.5 and 0.5
     std::uniform_real_distribution<> distrib(-0.5, 0.5);
 
-    auto topologicalOrder = topologicalSort(infimum, superconceptsMapping);
-
-    for (int i = 0; i < topologicalOrder->size(); i++) {
-        // It is super important to assign the Y values in the opposite direction: topologicalOrder->size() - 1 - i
-        int conceptIndex = (*topologicalOrder)[topologicalOrder->size() - 1 - i];
+    for (int i = 0; i < topologicalOrder.size(); i++) {
+        // It is super important to assign the Y values in the opposite direction: topologicalOrder.size() - 1 - i
+        int conceptIndex = topologicalOrder[topologicalOrder.size() - 1 - i];
         int start = getStart(dimension, conceptIndex);
 
         layout[start] = i;
@@ -574,6 +616,36 @@ void initializeLayout(
     }
 }
 
+/**
+ * Moves the concepts to their positions in the previous layout.
+ * The previous layout is finalized, i.e. its first two coordinates are swapped.
+ */
+void seedLayout(
+    std::vector<float>& layout,
+    int conceptsCount,
+    int dimension,
+    const WarmStart& warmStart,
+    std::vector<int>& previousIndexes,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+) {
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        int start = getStart(dimension, conceptIndex);
+        float x, y, z;
+
+        if (!getWarmStartPosition(conceptIndex, warmStart, previousIndexes, subconceptsMapping, superconceptsMapping, x, y, z)) {
+            continue;
+        }
+
+        layout[start] = y;
+        layout[start + 1] = x;
+
+        if (dimension > 2) {
+            layout[start + 2] = z;
+        }
+    }
+}
+
 void finalizeLayout(std::vector<float>& layout, int conceptsCount, int targetDimension) {
     float minX = std::numeric_limits<float>::max();
     float maxX = std::numeric_limits<float>::min();
@@ -618,6 +690,8 @@ void reduceDimension(
     int conceptsCount,
     int dimension
 ) {
+    TRACE_SCOPE("reDrawLayout.reduceDimension");
+
     // Using PCA
     // https://en.wikipedia.org/wiki/Dimensionality_reduction#Principal_component_analysis_(PCA)
     // https://www.geeksforgeeks.org/data-analysis/principal-component-analysis-pca/
@@ -626,58 +700,71 @@ void reduceDimension(
     // Inspired by this implementation:
     // https://github.com/ogail/pca/blob/master/PrincipalComponentAnalysis/PrincipalComponentAnalysis/pca.h
 
+    // The covariance matrix is accumulated directly from the layout buffer
+    // and the layout is projected in place, so no copy of the whole layout is created.
+
     int newDimension = dimension - 1;
 
-    // Create a matrix containing all coordinates except the y-coordinate for all concepts
-    // Rows are concepts, columns are coordinates
-    Eigen::MatrixXd data(conceptsCount, newDimension);
+    // Mean of all coordinates except the y-coordinate
+    std::vector<double> mean(newDimension, 0);
 
-    for (int row = 0; row < conceptsCount; row++) {
-        int layoutStart = getStart(dimension, row);
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        int layoutStart = getStart(dimension, conceptIndex);
 
         for (int col = 0; col < newDimension; col++) {
-            data(row, col) = layout[layoutStart + 1 + col];
+            mean[col] += layout[layoutStart + 1 + col];
         }
     }
+    for (int col = 0; col < newDimension; col++) {
+        mean[col] /= conceptsCount;
+    }
 
-    // Standardize the data
-    Eigen::RowVectorXd mean = data.colwise().mean();
-    Eigen::MatrixXd centeredData = data.rowwise() - mean;
+    // Only the lower triangle of the covariance matrix is accumulated, the eigen solver does not read the rest
+    Eigen::MatrixXd covarianceMatrix = Eigen::MatrixXd::Zero(newDimension, newDimension);
+    std::vector<double> centered(newDimension);
 
-    // Compute eigenvectors and eigenvalues
-    Eigen::MatrixXd covarianceMatrix = (centeredData.transpose() * centeredData) / (conceptsCount - 1);
-    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigenSolver(covarianceMatrix);
-
-    // Principal components are columns
-    Eigen::MatrixXd eigenvectors = eigenSolver.eigenvectors().real();
-    Eigen::VectorXd eigenvalues = eigenSolver.eigenvalues().real();
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        int layoutStart = getStart(dimension, conceptIndex);
 
-    std::vector<std::pair<double, Eigen::VectorXd>> eigenPairs;
-    for (int i = 0; i < eigenvalues.size(); ++i) {
-        eigenPairs.push_back({ eigenvalues(i), eigenvectors.col(i) });
+        for (int col = 0; col < newDimension; col++) {
+            centered[col] = layout[layoutStart + 1 + col] - mean[col];
+        }
+        for (int row = 0; row < newDimension; row++) {
+            for (int col = 0; col <= row; col++) {
+                covarianceMatrix(row, col) += centered[row] * centered[col];
+            }
+        }
     }
 
-    // Sort in descending order of eigenvalues
-    std::sort(eigenPairs.rbegin(), eigenPairs.rend(),
-        [](const auto& a, const auto& b) { return a.first < b.first; });
-
-    Eigen::MatrixXd principalComponents(centeredData.cols(), newDimension - 1);
+    covarianceMatrix /= conceptsCount - 1;
 
-    for (int i = 0; i < newDimension - 1; i++) {
-        principalComponents.col(i) = eigenPairs[i].second;
-    }
+    // Compute eigenvectors and eigenvalues
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigenSolver(covarianceMatrix);
 
-    Eigen::MatrixXd projectedCenteredData = centeredData * principalComponents;
+    // Principal components are columns, the eigenvalues are sorted in increasing order
+    const Eigen::MatrixXd& eigenvectors = eigenSolver.eigenvectors();
 
     // Update the layout and reduce its dimension
+    // The new coordinates of a concept never overlap the old coordinates of the following concepts
     for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
         int oldLayoutStart = getStart(dimension, conceptIndex);
         int newLayoutStart = getStart(newDimension, conceptIndex);
 
+        for (int col = 0; col < newDimension; col++) {
+            centered[col] = layout[oldLayoutStart + 1 + col] - mean[col];
+        }
+
         layout[newLayoutStart] = layout[oldLayoutStart];
 
-        for (int col = 0; col < newDimension - 1; col++) {
-            layout[newLayoutStart + col + 1] = projectedCenteredData(conceptIndex, col);
+        for (int component = 0; component < newDimension - 1; component++) {
+            const auto& principalComponent = eigenvectors.col(newDimension - 1 - component);
+            double projected = 0;
+
+            for (int col = 0; col < newDimension; col++) {
+                projected += centered[col] * principalComponent(col);
+            }
+
+            layout[newLayoutStart + component + 1] = projected;
         }
 
         if (newDimension == 2) {
@@ -688,28 +775,95 @@ void reduceDimension(
     layout.resize(conceptsCount * getLayoutDimension(newDimension));
 }
 
+std::unique_ptr<std::vector<int>> computeReDrawTopologicalOrder(
+    int infimum,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+) {
+    auto superconcepts = createCompactMapping(superconceptsMapping);
+    return topologicalSort(infimum, superconcepts);
+}
+
+void computeReDrawLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
+    std::function<void(double)> onProgress
+) {
+    long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    auto topologicalOrder = computeReDrawTopologicalOrder(infimum, superconceptsMapping);
+
+    computeReDrawLayout(
+        result,
+        supremum,
+        infimum,
+        conceptsCount,
+        subconceptsMapping,
+        superconceptsMapping,
+        *topologicalOrder,
+        seed,
+        targetDimension,
+        parallelize,
+        convergenceCriteria,
+        warmStart,
+        onProgress);
+
+    long long endTime = nowMills();
+
+    result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+}
+
 void computeReDrawLayout(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
     std::vector<std::unordered_set<int>>& subconceptsMapping,
     std::vector<std::unordered_set<int>>& superconceptsMapping,
+    const std::vector<int>& topologicalOrder,
     unsigned int seed,
     int targetDimension,
     bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
     std::function<void(double)> onProgress
 ) {
+    TRACE_SCOPE("reDrawLayout");
     long long startTime = nowMills();
+    MemoryTracker memoryTracker;
+
+    auto convergence = ConvergenceTracker(convergenceCriteria, startTime);
+    // A warm-started layout is relaxed only in the target dimension
+    int initialDimension = warmStart ? targetDimension : INITIAL_DIMENSION;
+    int iterationsCount = warmStart ? WARM_START_ITERATIONS_COUNT : ITERATIONS_COUNT;
 
     auto progress = ProgressData(
-        (INITIAL_DIMENSION - targetDimension + 1) * (parallelize ? 2 : 1),
+        (initialDimension - targetDimension + 1) * (parallelize ? 2 : 1),
         onProgress);
 
-    initializeLayout(result.value, conceptsCount, INITIAL_DIMENSION, infimum, superconceptsMapping, seed);
+    initializeLayout(result.value, conceptsCount, initialDimension, topologicalOrder, seed);
     std::vector<float> forces;
+    std::vector<bool> movableConcepts(conceptsCount, true);
+
+    if (warmStart) {
+        // Only the region affected by the changes of the lattice is relaxed, the rest stays where it was
+        auto previousIndexes = getPreviousIndexes(*warmStart, conceptsCount);
+        movableConcepts = getAffectedConcepts(*warmStart, previousIndexes, subconceptsMapping, superconceptsMapping);
+
+        seedLayout(result.value, conceptsCount, initialDimension, *warmStart, previousIndexes, subconceptsMapping, superconceptsMapping);
+    }
 
-    for (int dimension = INITIAL_DIMENSION; dimension >= targetDimension; dimension--) {
+    for (int dimension = initialDimension; dimension >= targetDimension; dimension--) {
         round(
             result.value,
             forces,
@@ -718,6 +872,9 @@ void computeReDrawLayout(
             subconceptsMapping,
             superconceptsMapping,
             parallelize,
+            movableConcepts,
+            iterationsCount,
+            convergence,
             progress);
 
         if (dimension != targetDimension) {
@@ -730,4 +887,7 @@ void computeReDrawLayout(
     long long endTime = nowMills();
 
     result.time = (int)(endTime - startTime);
+    result.memory = memoryTracker.finish();
+    result.iterationsCount = convergence.getIterationsCount();
+    result.stopReason = convergence.getStopReason();
 }
\ No newline at end of file
@@ -2,12 +2,16 @@
 #define REDRAW_LAYOUT_H
 
 #include <vector>
+#include <memory>
 #include <unordered_set>
 #include <functional>
-#include "../types/TimedResult.h"
+#include <optional>
+#include "../types/IterativeTimedResult.h"
+#include "../types/ConvergenceCriteria.h"
+#include "warmStart.h"
 
 void computeReDrawLayout(
-    TimedResult<std::vector<float>>& result,
+    IterativeTimedResult<std::vector<float>>& result,
     int supremum,
     int infimum,
     int conceptsCount,
@@ -16,7 +20,36 @@ void computeReDrawLayout(
     unsigned int seed,
     int targetDimension,
     bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
     std::function<void(double)> onProgress
 );
 
+/**
+ * Computes the ReDraw layout with the topological order of the concepts already computed by computeReDrawTopologicalOrder.
+ */
+void computeReDrawLayout(
+    IterativeTimedResult<std::vector<float>>& result,
+    int supremum,
+    int infimum,
+    int conceptsCount,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    const std::vector<int>& topologicalOrder,
+    unsigned int seed,
+    int targetDimension,
+    bool parallelize,
+    ConvergenceCriteria convergenceCriteria,
+    const std::optional<WarmStart>& warmStart,
+    std::function<void(double)> onProgress
+);
+
+/**
+ * Computes the topological order of the concepts that is used to initialize the ReDraw layout.
+ */
+std::unique_ptr<std::vector<int>> computeReDrawTopologicalOrder(
+    int infimum,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+);
+
 #endif
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <unordered_set>
 #include <queue>
 #include <functional>
+#include <algorithm>
 
 float getX(std::vector<float>& layout, int index) {
     return layout[index * COORDS_COUNT];
@@ -25,50 +26,81 @@ void setZ(std::vector<float>& layout, int index, float value) {
     layout[index * COORDS_COUNT + 2] = value;
 }
 
-void topologicalSortImpl(
-    int currentIndex,
-    std::vector<std::unordered_set<int>>& coverRelation,
-    std::vector<bool>& visited,
-    std::vector<int>& topologicalOrder,
-    std::shared_ptr<int> sortedLastIndex
-) {
-    // https://en.wikipedia.org/wiki/Longest_path_problem#Acyclic_graphs
+CompactMapping createCompactMapping(std::vector<std::unordered_set<int>>& mapping) {
+    CompactMapping compactMapping;
+    compactMapping.offsets.reserve(mapping.size() + 1);
+    compactMapping.offsets.push_back(0);
+
+    for (auto& neighbors : mapping) {
+        compactMapping.nodes.insert(compactMapping.nodes.end(), neighbors.begin(), neighbors.end());
+        compactMapping.offsets.push_back(compactMapping.nodes.size());
+    }
 
-    std::unordered_set<int>& subconcepts = coverRelation[currentIndex];
-    visited[currentIndex] = true;
-
-    for (int subconceptIndex : subconcepts) {
-        if (!visited[subconceptIndex]) {
-            topologicalSortImpl(
-                subconceptIndex,
-                coverRelation,
-                visited,
-                topologicalOrder,
-                sortedLastIndex);
+    return compactMapping;
+}
+
+std::unique_ptr<std::vector<int>> topologicalSort(int startConceptIndex, CompactMapping& coverRelation) {
+    // https://en.wikipedia.org/wiki/Topological_sorting#Depth-first_search
+    // The explicit stack replaces the recursion so that deep lattices cannot overflow the call stack.
+    int nodesCount = coverRelation.offsets.size() - 1;
+    std::unique_ptr<std::vector<int>> topologicalOrder = std::make_unique<std::vector<int>>(nodesCount);
+    std::vector<bool> visited(nodesCount, false);
+    // Position of the next neighbor to visit of each node on the stack
+    std::vector<int> nextNeighbors(nodesCount);
+    std::vector<int> stack;
+    int sortedLastIndex = nodesCount - 1;
+
+    visited[startConceptIndex] = true;
+    nextNeighbors[startConceptIndex] = coverRelation.offsets[startConceptIndex];
+    stack.push_back(startConceptIndex);
+
+    while (!stack.empty()) {
+        int currentIndex = stack.back();
+
+        if (nextNeighbors[currentIndex] < coverRelation.offsets[currentIndex + 1]) {
+            int subconceptIndex = coverRelation.nodes[nextNeighbors[currentIndex]];
+            nextNeighbors[currentIndex]++;
+
+            if (!visited[subconceptIndex]) {
+                visited[subconceptIndex] = true;
+                nextNeighbors[subconceptIndex] = coverRelation.offsets[subconceptIndex];
+                stack.push_back(subconceptIndex);
+            }
+        }
+        else {
+            // All descendants are sorted, the node precedes them
+            (*topologicalOrder)[sortedLastIndex] = currentIndex;
+            sortedLastIndex--;
+            stack.pop_back();
         }
     }
 
-    topologicalOrder[*sortedLastIndex] = currentIndex;
-    *sortedLastIndex = *sortedLastIndex - 1;
+    return topologicalOrder;
 }
 
-std::unique_ptr<std::vector<int>> topologicalSort(int startConceptIndex, std::vector<std::unordered_set<int>>& coverRelation) {
-    std::unique_ptr<std::vector<int>> topologicalOrder = std::make_unique<std::vector<int>>();
-    std::vector<bool> visited;
-    std::shared_ptr<int> sortedLastIndex = std::make_shared<int>();
+std::vector<int> computeLongestPathLayers(int startConceptIndex, CompactMapping& coverRelation) {
+    // https://en.wikipedia.org/wiki/Longest_path_problem#Acyclic_graphs
+    int nodesCount = coverRelation.offsets.size() - 1;
+    std::vector<int> layersMapping(nodesCount, -1);
+    std::unique_ptr<std::vector<int>> topologicalOrder = topologicalSort(startConceptIndex, coverRelation);
 
-    visited.resize(coverRelation.size());
-    topologicalOrder->resize(coverRelation.size());
-    *sortedLastIndex = coverRelation.size() - 1;
+    layersMapping[startConceptIndex] = 0;
 
-    topologicalSortImpl(
-        startConceptIndex,
-        coverRelation,
-        visited,
-        *topologicalOrder,
-        sortedLastIndex);
+    for (int orderedIndex : *topologicalOrder) {
+        if (layersMapping[orderedIndex] == -1) {
+            // Slots before the reachable nodes are not part of the order
+            continue;
+        }
 
-    return topologicalOrder;
+        int newLayer = layersMapping[orderedIndex] + 1;
+
+        for (int i = coverRelation.offsets[orderedIndex]; i < coverRelation.offsets[orderedIndex + 1]; i++) {
+            int subconceptIndex = coverRelation.nodes[i];
+            layersMapping[subconceptIndex] = std::max(layersMapping[subconceptIndex], newLayer);
+        }
+    }
+
+    return layersMapping;
 }
 
 void getComparableConceptsOneWay(
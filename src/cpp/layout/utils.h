@@ -15,7 +15,22 @@ void setX(std::vector<float>& layout, int index, float value);
 void setY(std::vector<float>& layout, int index, float value);
 void setZ(std::vector<float>& layout, int index, float value);
 
-std::unique_ptr<std::vector<int>> topologicalSort(int startConceptIndex, std::vector<std::unordered_set<int>>& coverRelation);
+/// @brief Adjacency lists of all nodes stored in two flat arrays.
+/// Neighbors of node i are stored in nodes[offsets[i]] ... nodes[offsets[i + 1] - 1].
+struct CompactMapping {
+    std::vector<int> offsets;
+    std::vector<int> nodes;
+};
+
+CompactMapping createCompactMapping(std::vector<std::unordered_set<int>>& mapping);
+
+/// @brief Sorts the nodes reachable from the start concept topologically using an iterative depth-first search.
+/// @return Topological order of the nodes, the reachable nodes are stored at the end of the vector
+std::unique_ptr<std::vector<int>> topologicalSort(int startConceptIndex, CompactMapping& coverRelation);
+
+/// @brief Assigns each node reachable from the start concept the length of the longest path from the start concept.
+/// @return Layer of each node, -1 for the unreachable nodes
+std::vector<int> computeLongestPathLayers(int startConceptIndex, CompactMapping& coverRelation);
 
 std::unique_ptr<std::unordered_set<int>> getComparableConcepts(
     int conceptIndex,
@@ -0,0 +1,145 @@
+#include "utils.h"
+#include "warmStart.h"
+
+#include <vector>
+#include <unordered_set>
+#include <queue>
+
+std::vector<int> getPreviousIndexes(const WarmStart& warmStart, int conceptsCount) {
+    std::vector<int> previousIndexes(conceptsCount, -1);
+
+    for (int previousIndex = 0; previousIndex < warmStart.newIndexes.size(); previousIndex++) {
+        int newIndex = warmStart.newIndexes[previousIndex];
+
+        if (newIndex >= 0 && newIndex < conceptsCount && (previousIndex + 1) * COORDS_COUNT <= warmStart.previousLayout.size()) {
+            previousIndexes[newIndex] = previousIndex;
+        }
+    }
+
+    return previousIndexes;
+}
+
+void addPreviousPosition(
+    int conceptIndex,
+    const WarmStart& warmStart,
+    std::vector<int>& previousIndexes,
+    float& x,
+    float& y,
+    float& z,
+    int& count
+) {
+    int previousIndex = previousIndexes[conceptIndex];
+
+    if (previousIndex == -1) {
+        return;
+    }
+
+    int start = previousIndex * COORDS_COUNT;
+
+    x += warmStart.previousLayout[start];
+    y += warmStart.previousLayout[start + 1];
+    z += warmStart.previousLayout[start + 2];
+    count++;
+}
+
+bool getWarmStartPosition(
+    int conceptIndex,
+    const WarmStart& warmStart,
+    std::vector<int>& previousIndexes,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    float& x,
+    float& y,
+    float& z
+) {
+    x = 0;
+    y = 0;
+    z = 0;
+    int count = 0;
+
+    addPreviousPosition(conceptIndex, warmStart, previousIndexes, x, y, z, count);
+
+    if (count > 0) {
+        return true;
+    }
+
+    for (int subconcept : subconceptsMapping[conceptIndex]) {
+        addPreviousPosition(subconcept, warmStart, previousIndexes, x, y, z, count);
+    }
+    for (int superconcept : superconceptsMapping[conceptIndex]) {
+        addPreviousPosition(superconcept, warmStart, previousIndexes, x, y, z, count);
+    }
+
+    if (count == 0) {
+        return false;
+    }
+
+    x /= count;
+    y /= count;
+    z /= count;
+
+    return true;
+}
+
+std::vector<bool> getAffectedConcepts(
+    const WarmStart& warmStart,
+    std::vector<int>& previousIndexes,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+) {
+    int conceptsCount = previousIndexes.size();
+    std::vector<bool> affected(conceptsCount, false);
+    std::vector<int> distances(conceptsCount, -1);
+    std::queue<int> conceptsQueue;
+
+    auto markAffected = [&](int conceptIndex) {
+        if (distances[conceptIndex] == -1) {
+            distances[conceptIndex] = 0;
+            conceptsQueue.push(conceptIndex);
+        }
+    };
+
+    for (int conceptIndex = 0; conceptIndex < conceptsCount; conceptIndex++) {
+        int previousIndex = previousIndexes[conceptIndex];
+
+        if (previousIndex == -1) {
+            markAffected(conceptIndex);
+            continue;
+        }
+
+        float previousY = warmStart.previousLayout[previousIndex * COORDS_COUNT + 1];
+
+        for (int subconcept : subconceptsMapping[conceptIndex]) {
+            int previousSubconceptIndex = previousIndexes[subconcept];
+
+            if (previousSubconceptIndex != -1 &&
+                warmStart.previousLayout[previousSubconceptIndex * COORDS_COUNT + 1] > previousY) {
+                markAffected(conceptIndex);
+                markAffected(subconcept);
+            }
+        }
+    }
+
+    // Expand the affected region by WARM_START_RADIUS cover edges
+    while (!conceptsQueue.empty()) {
+        int conceptIndex = conceptsQueue.front();
+        conceptsQueue.pop();
+
+        affected[conceptIndex] = true;
+
+        if (distances[conceptIndex] == WARM_START_RADIUS) {
+            continue;
+        }
+
+        for (auto mapping : { &subconceptsMapping, &superconceptsMapping }) {
+            for (int neighbor : (*mapping)[conceptIndex]) {
+                if (distances[neighbor] == -1) {
+                    distances[neighbor] = distances[conceptIndex] + 1;
+                    conceptsQueue.push(neighbor);
+                }
+            }
+        }
+    }
+
+    return affected;
+}
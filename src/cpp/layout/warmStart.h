@@ -0,0 +1,48 @@
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <vector>
+#include <unordered_set>
+
+#define WARM_START_RADIUS 1
+
+/// @brief Previously computed layout that a new layout can be seeded from.
+struct WarmStart {
+    /// @brief Coordinates of the previous concepts, COORDS_COUNT values per concept.
+    std::vector<float> previousLayout;
+    /// @brief New index of each previous concept, -1 if the concept is not present anymore.
+    std::vector<int> newIndexes;
+};
+
+/// @brief Inverts the mapping of the warm start.
+/// @param warmStart
+/// @param conceptsCount
+/// @return Previous index of each new concept, -1 if the concept is new.
+std::vector<int> getPreviousIndexes(const WarmStart& warmStart, int conceptsCount);
+
+/// @brief Finds a seed position of a concept in the previous layout.
+/// New concepts are placed to the average position of their cover neighbors that were present in the previous layout.
+/// @return false if the position could not be determined.
+bool getWarmStartPosition(
+    int conceptIndex,
+    const WarmStart& warmStart,
+    std::vector<int>& previousIndexes,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping,
+    float& x,
+    float& y,
+    float& z
+);
+
+/// @brief Collects the concepts that are affected by changes of the lattice and should be relaxed.
+/// A concept is affected if it is new, if it violates the vertical order of the previous layout with one of its neighbors
+/// or if it is at most WARM_START_RADIUS cover edges far from such a concept.
+/// @return Flag for each concept.
+std::vector<bool> getAffectedConcepts(
+    const WarmStart& warmStart,
+    std::vector<int>& previousIndexes,
+    std::vector<std::unordered_set<int>>& subconceptsMapping,
+    std::vector<std::unordered_set<int>>& superconceptsMapping
+);
+
+#endif
@@ -1,6 +1,12 @@
 #include "types/FormalConcept.h"
+#include "types/CompressedFormalConcept.h"
+#include "types/Implication.h"
 #include "types/FormalContext.h"
+#include "types/ParsedContext.h"
 #include "types/TimedResult.h"
+#include "types/IterativeTimedResult.h"
+#include "types/ConvergenceCriteria.h"
+#include "types/MemoryUsage.h"
 #include "types/OnProgressCallback.h"
 
 #include <emscripten/bind.h>
@@ -12,11 +18,25 @@
 #include <chrono>
 
 #include "utils.cpp"
+#include "trace.cpp"
+#include "memory.cpp"
+#include "parallel.cpp"
 #include "burmeister.cpp"
+#include "contextParsing.cpp"
+#include "csv.cpp"
+#include "json.cpp"
+#include "xml.cpp"
+#include "parsers.cpp"
+#include "compressedExtent.cpp"
 #include "inClose.cpp"
 #include "conceptsCover.cpp"
+#include "implicationBasis.cpp"
 #include "layout/utils.cpp"
+#include "layout/convergence.cpp"
+#include "layout/warmStart.cpp"
 #include "layout/layers.cpp"
+#include "layout/coffmanGrahamLayers.cpp"
+#include "layout/networkSimplexLayers.cpp"
 #include "layout/layered/crossCount.cpp"
 #include "layout/layered/dummies.cpp"
 #include "layout/layered/simplePlacement.cpp"
@@ -25,6 +45,8 @@
 #include "layout/layered/layeredLayout.cpp"
 #include "layout/freeseLayout.cpp"
 #include "layout/reDrawLayout.cpp"
+#include "layout/multilevelLayout.cpp"
+#include "layout/layoutSession.cpp"
 #include "layout/layouts.cpp"
 
 using namespace emscripten;
@@ -40,6 +62,8 @@ EMSCRIPTEN_BINDINGS(my_module) {
     emscripten::register_vector<float>("FloatArray");
     emscripten::register_vector<FormalConcept>("FormalConceptArray");
     emscripten::register_vector<SimpleFormalConcept>("SimpleFormalConceptArray");
+    emscripten::register_vector<CompressedFormalConcept>("CompressedFormalConceptArray");
+    emscripten::register_vector<Implication>("ImplicationArray");
     emscripten::register_vector<std::vector<int>>("IntMultiArray");
 
     emscripten::class_<FormalContext>("FormalContext")
@@ -50,6 +74,14 @@ EMSCRIPTEN_BINDINGS(my_module) {
         .property("attributes", &FormalContext::getAttributesCopy, &FormalContext::setAttributes)
         .property("context", &FormalContext::getContextCopy, &FormalContext::setContext);
 
+    emscripten::class_<ParsedContext>("ParsedContext")
+        .constructor<>()
+        .property("name", &ParsedContext::name)
+        .property("hasName", &ParsedContext::hasName)
+        .property("hasConcepts", &ParsedContext::hasConcepts)
+        .property("objects", &getParsedContextObjects)
+        .property("attributes", &getParsedContextAttributes);
+
     emscripten::class_<FormalConcept>("FormalConcept")
         .constructor()
         .property("objects", &FormalConcept::getObjectsCopy, &FormalConcept::setObjects)
@@ -60,33 +92,98 @@ EMSCRIPTEN_BINDINGS(my_module) {
         .property("objects", &SimpleFormalConcept::getObjectsCopy, &SimpleFormalConcept::setObjects)
         .property("attributes", &SimpleFormalConcept::getAttributesCopy, &SimpleFormalConcept::setAttributes);
 
+    // The extents are decompressed when they are read
+    emscripten::class_<CompressedFormalConcept>("CompressedFormalConcept")
+        .constructor()
+        .property("objects", &CompressedFormalConcept::getObjectsCopy)
+        .property("attributes", &CompressedFormalConcept::getAttributesCopy, &CompressedFormalConcept::setAttributes);
+
+    emscripten::class_<Implication>("Implication")
+        .constructor()
+        .property("premise", &Implication::getPremiseCopy, &Implication::setPremise)
+        .property("conclusion", &Implication::getConclusionCopy, &Implication::setConclusion);
+
     emscripten::class_<TimedResult<std::vector<FormalConcept>>>("FormalConceptsTimedResult")
         .constructor<>()
         .property("value", &TimedResult<std::vector<FormalConcept>>::value)
-        .property("time", &TimedResult<std::vector<FormalConcept>>::time);
+        .property("time", &TimedResult<std::vector<FormalConcept>>::time)
+        .property("memory", &TimedResult<std::vector<FormalConcept>>::memory);
+
+    emscripten::class_<TimedResult<std::vector<CompressedFormalConcept>>>("CompressedFormalConceptsTimedResult")
+        .constructor<>()
+        .property("value", &TimedResult<std::vector<CompressedFormalConcept>>::value)
+        .property("time", &TimedResult<std::vector<CompressedFormalConcept>>::time)
+        .property("memory", &TimedResult<std::vector<CompressedFormalConcept>>::memory);
+
+    emscripten::class_<TimedResult<std::vector<Implication>>>("ImplicationsTimedResult")
+        .constructor<>()
+        .property("value", &TimedResult<std::vector<Implication>>::value)
+        .property("time", &TimedResult<std::vector<Implication>>::time)
+        .property("memory", &TimedResult<std::vector<Implication>>::memory);
 
     emscripten::class_<TimedResult<std::vector<std::vector<int>>>>("IntMultiArrayTimedResult")
         .constructor<>()
         .property("value", &TimedResult<std::vector<std::vector<int>>>::value)
-        .property("time", &TimedResult<std::vector<std::vector<int>>>::time);
+        .property("time", &TimedResult<std::vector<std::vector<int>>>::time)
+        .property("memory", &TimedResult<std::vector<std::vector<int>>>::memory);
 
     emscripten::class_<TimedResult<std::vector<int>>>("IntArrayTimedResult")
         .constructor<>()
         .property("value", &TimedResult<std::vector<int>>::value)
-        .property("time", &TimedResult<std::vector<int>>::time);
+        .property("time", &TimedResult<std::vector<int>>::time)
+        .property("memory", &TimedResult<std::vector<int>>::memory);
 
     emscripten::class_<TimedResult<std::vector<float>>>("FloatArrayTimedResult")
         .constructor<>()
         .property("value", &TimedResult<std::vector<float>>::value)
-        .property("time", &TimedResult<std::vector<float>>::time);
+        .property("time", &TimedResult<std::vector<float>>::time)
+        .property("memory", &TimedResult<std::vector<float>>::memory);
+
+    emscripten::class_<IterativeTimedResult<std::vector<float>>, emscripten::base<TimedResult<std::vector<float>>>>("FloatArrayIterativeTimedResult")
+        .constructor<>()
+        .property("iterationsCount", &IterativeTimedResult<std::vector<float>>::iterationsCount)
+        .property("stopReason", &IterativeTimedResult<std::vector<float>>::stopReason);
+
+    emscripten::value_object<MemoryUsage>("MemoryUsage")
+        .field("allocatedBytes", &MemoryUsage::allocatedBytes)
+        .field("peakBytes", &MemoryUsage::peakBytes)
+        .field("allocationsCount", &MemoryUsage::allocationsCount);
+
+    emscripten::value_object<ConvergenceCriteria>("ConvergenceCriteria")
+        .field("maxDisplacement", &ConvergenceCriteria::maxDisplacement)
+        .field("energyDelta", &ConvergenceCriteria::energyDelta)
+        .field("timeBudget", &ConvergenceCriteria::timeBudget);
 
     emscripten::function("parseBurmeister", &parseBurmeister);
+    emscripten::function("parseBurmeisterInChunks", &parseBurmeisterInChunks);
+    emscripten::function("parseBurmeisterContext", &parseBurmeisterJs);
+    emscripten::function("parseCsv", &parseCsvJs);
+    emscripten::function("parseJson", &parseJsonJs);
+    emscripten::function("parseXml", &parseXmlJs);
+    emscripten::function("getParsedContextMatrixView", &getParsedContextMatrixView);
     emscripten::function("formalContextHasAttribute", &formalContextHasAttribute);
     emscripten::function("inClose", &inClose);
+    emscripten::function("inCloseCompressed", &inCloseCompressed);
     emscripten::function("conceptsCover", &conceptsCover);
+    emscripten::function("duquenneGuiguesBasis", &duquenneGuiguesBasis);
     emscripten::function("computeLayeredLayout", &computeLayeredLayoutJs);
     emscripten::function("computeFreeseLayout", &computeFreeseLayoutJs);
     emscripten::function("computeReDrawLayout", &computeReDrawLayoutJs);
+    emscripten::function("computeMultilevelLayout", &computeMultilevelLayoutJs);
+    emscripten::function("isTraceEnabled", &isTraceEnabled);
+    emscripten::function("resetTrace", &resetTrace);
+    emscripten::function("exportTraceJson", &exportTraceJson);
+
+    emscripten::class_<LayoutSession>("LayoutSession")
+        .constructor(&createLayoutSessionJs, emscripten::allow_raw_pointers())
+        .property("supremum", &LayoutSession::getSupremum)
+        .property("infimum", &LayoutSession::getInfimum)
+        .property("conceptsCount", &LayoutSession::getConceptsCount)
+        .property("mappingsMemory", &LayoutSession::getMappingsMemory)
+        .function("computeLayeredLayout", &computeSessionLayeredLayoutJs)
+        .function("computeFreeseLayout", &computeSessionFreeseLayoutJs)
+        .function("computeReDrawLayout", &computeSessionReDrawLayoutJs)
+        .function("computeMultilevelLayout", &computeSessionMultilevelLayoutJs);
 
     emscripten::register_type<OnProgressCallback>("((progress: number) => void) | undefined");
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "mappedFile.h"
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MEMORY_MAPPING_ENABLED
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& filePath) : data(nullptr), size(0), mapped(false) {
+#ifdef MEMORY_MAPPING_ENABLED
+    int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0) {
+        throw std::runtime_error("File " + filePath + " could not be opened");
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fileDescriptor, &fileStat) != 0) {
+        close(fileDescriptor);
+        throw std::runtime_error("File " + filePath + " could not be read");
+    }
+
+    size = fileStat.st_size;
+
+    // Empty files cannot be mapped
+    if (size > 0) {
+        void* memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        if (memory == MAP_FAILED) {
+            close(fileDescriptor);
+            throw std::runtime_error("File " + filePath + " could not be mapped");
+        }
+
+        // The parsers read the file from the start to the end
+        madvise(memory, size, MADV_SEQUENTIAL);
+
+        data = static_cast<const char*>(memory);
+        mapped = true;
+    }
+
+    // The mapping stays valid after the file is closed
+    close(fileDescriptor);
+#else
+    std::ifstream file(filePath, std::ios::binary);
+
+    if (!file.is_open()) {
+        throw std::runtime_error("File " + filePath + " could not be opened");
+    }
+
+    std::stringstream stream;
+    stream << file.rdbuf();
+    buffer = stream.str();
+
+    data = buffer.data();
+    size = buffer.size();
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef MEMORY_MAPPING_ENABLED
+    if (mapped) {
+        munmap(const_cast<char*>(data), size);
+    }
+#endif
+}
\ No newline at end of file
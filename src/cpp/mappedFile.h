@@ -0,0 +1,32 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+/**
+ * Read-only view of a whole file.
+ *
+ * On POSIX systems, the file is mapped into memory, so its content is not copied
+ * and pages are loaded by the kernel as they are read. Elsewhere, the file is read into a buffer.
+ */
+class MappedFile {
+public:
+    /// @throws std::runtime_error if the file cannot be opened or mapped.
+    MappedFile(const std::string& filePath);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view getContent() const { return std::string_view(data, size); }
+
+private:
+    const char* data;
+    size_t size;
+    bool mapped;
+    std::string buffer;
+};
+
+#endif
\ No newline at end of file
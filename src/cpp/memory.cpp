@@ -0,0 +1,123 @@
+#include "memory.h"
+#include "types/MemoryUsage.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <algorithm>
+
+// Counters of the replaced operator new and delete
+std::atomic<size_t> totalAllocatedBytes(0);
+std::atomic<size_t> currentBytes(0);
+std::atomic<size_t> peakBytes(0);
+std::atomic<size_t> totalAllocationsCount(0);
+
+// Size of each allocation is stored in front of it, the header keeps the fundamental alignment of the returned memory
+#define ALLOCATION_HEADER_SIZE alignof(std::max_align_t)
+
+void updatePeakBytes(size_t bytes) {
+    size_t peak = peakBytes.load(std::memory_order_relaxed);
+
+    while (bytes > peak && !peakBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+    }
+}
+
+void* countedAllocate(size_t size) {
+    void* memory = std::malloc(size + ALLOCATION_HEADER_SIZE);
+
+    if (!memory) {
+        return nullptr;
+    }
+
+    *static_cast<size_t*>(memory) = size;
+
+    totalAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    totalAllocationsCount.fetch_add(1, std::memory_order_relaxed);
+    updatePeakBytes(currentBytes.fetch_add(size, std::memory_order_relaxed) + size);
+
+    return static_cast<char*>(memory) + ALLOCATION_HEADER_SIZE;
+}
+
+void countedFree(void* pointer) {
+    if (!pointer) {
+        return;
+    }
+
+    void* memory = static_cast<char*>(pointer) - ALLOCATION_HEADER_SIZE;
+
+    currentBytes.fetch_sub(*static_cast<size_t*>(memory), std::memory_order_relaxed);
+    std::free(memory);
+}
+
+void* operator new(size_t size) {
+    void* pointer = countedAllocate(size);
+
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+
+size_t currentAllocatedBytes() {
+    return currentBytes.load(std::memory_order_relaxed);
+}
+
+MemoryTracker::MemoryTracker() :
+    startAllocatedBytes(totalAllocatedBytes.load(std::memory_order_relaxed)),
+    startCurrentBytes(currentBytes.load(std::memory_order_relaxed)),
+    startAllocationsCount(totalAllocationsCount.load(std::memory_order_relaxed)),
+    // The peak is measured from the current usage, the previous peak is restored by finish()
+    previousPeakBytes(peakBytes.exchange(startCurrentBytes, std::memory_order_relaxed)) {
+}
+
+MemoryUsage MemoryTracker::finish() {
+    MemoryUsage usage;
+    size_t stagePeakBytes = peakBytes.load(std::memory_order_relaxed);
+
+    usage.allocatedBytes = totalAllocatedBytes.load(std::memory_order_relaxed) - startAllocatedBytes;
+    usage.allocationsCount = totalAllocationsCount.load(std::memory_order_relaxed) - startAllocationsCount;
+    usage.peakBytes = stagePeakBytes > startCurrentBytes ? stagePeakBytes - startCurrentBytes : 0;
+
+    // An enclosing stage has to see the peak of this stage as well
+    updatePeakBytes(previousPeakBytes);
+
+    return usage;
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include "types/MemoryUsage.h"
+#include <cstddef>
+
+/**
+ * Measures the heap usage of a computation stage, from the construction to the call of finish().
+ *
+ * The usage is counted by the replaced global operator new and delete,
+ * so the allocations of all threads are attributed to the running stage.
+ * Stages can be nested, but stages running concurrently cannot be told apart.
+ */
+class MemoryTracker {
+public:
+    MemoryTracker();
+
+    MemoryUsage finish();
+
+private:
+    size_t startAllocatedBytes;
+    size_t startCurrentBytes;
+    size_t startAllocationsCount;
+    size_t previousPeakBytes;
+};
+
+/// @brief Number of bytes currently allocated by operator new.
+size_t currentAllocatedBytes();
+
+#endif
\ No newline at end of file
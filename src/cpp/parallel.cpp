@@ -0,0 +1,76 @@
+#include "parallel.h"
+
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include <functional>
+
+#ifdef THREADS_ENABLED
+#include <thread>
+#endif
+
+// Set while the current thread runs a task of runInParallel
+thread_local bool isInsideParallelTask = false;
+
+int getThreadsCount(int tasksCount) {
+#ifdef THREADS_ENABLED
+    if (isInsideParallelTask) {
+        // Nested parallel regions run sequentially, the outer region already occupies the threads
+        return 1;
+    }
+
+    int hardwareThreadsCount = std::max((int)std::thread::hardware_concurrency(), 1);
+    return std::max(std::min(hardwareThreadsCount, tasksCount), 1);
+#else
+    return 1;
+#endif
+}
+
+void runInParallel(int threadsCount, const std::function<void(int)>& task) {
+#ifdef THREADS_ENABLED
+    if (threadsCount <= 1) {
+        // A single task does not occupy the other threads, so it may still use them for nested regions
+        task(0);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(threadsCount);
+
+    auto runTask = [&task, &exceptions](int threadIndex) {
+        bool wasInsideParallelTask = isInsideParallelTask;
+        isInsideParallelTask = true;
+
+        try {
+            task(threadIndex);
+        }
+        catch (...) {
+            exceptions[threadIndex] = std::current_exception();
+        }
+
+        isInsideParallelTask = wasInsideParallelTask;
+    };
+
+    threads.reserve(threadsCount - 1);
+
+    for (int threadIndex = 1; threadIndex < threadsCount; threadIndex++) {
+        threads.emplace_back(runTask, threadIndex);
+    }
+
+    runTask(0);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+#else
+    for (int threadIndex = 0; threadIndex < threadsCount; threadIndex++) {
+        task(threadIndex);
+    }
+#endif
+}
@@ -0,0 +1,22 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <functional>
+
+// Threads are available natively and in wasm builds compiled with -pthread
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define THREADS_ENABLED
+#endif
+
+/// @brief Returns the number of threads that should be used for the given number of independent tasks.
+/// @param tasksCount
+/// @return 1 if threads are not available or if called from a task of runInParallel that runs on multiple threads.
+int getThreadsCount(int tasksCount);
+
+/// @brief Runs the task on the given number of threads and waits for all of them to finish.
+/// The calling thread runs the task with index 0. The first exception thrown by a task is rethrown.
+/// @param threadsCount
+/// @param task Receives the index of the thread.
+void runInParallel(int threadsCount, const std::function<void(int)>& task);
+
+#endif
@@ -0,0 +1,56 @@
+#include "types/FormalContext.h"
+#include "types/ParsedContext.h"
+#include "burmeister.h"
+#include "csv.h"
+#include "json.h"
+#include "xml.h"
+#include "parsers.h"
+
+#include <emscripten/val.h>
+#include <string>
+#include <vector>
+#include <exception>
+#include <functional>
+
+std::string runParser(const std::function<void()>& parse) {
+    try {
+        parse();
+        return "";
+    }
+    catch (const std::exception& e) {
+        return e.what();
+    }
+}
+
+std::string parseBurmeisterJs(ParsedContext& result, const std::string& fileContent, bool parallelize) {
+    return runParser([&]() { result.context = parseBurmeister(fileContent, parallelize); });
+}
+
+std::string parseCsvJs(ParsedContext& result, const std::string& fileContent, const std::string& separator) {
+    if (separator.size() != 1) {
+        return "Invalid separator.";
+    }
+
+    return runParser([&]() { parseCsv(result, fileContent, separator[0]); });
+}
+
+std::string parseJsonJs(ParsedContext& result, const std::string& fileContent) {
+    return runParser([&]() { parseJson(result, fileContent); });
+}
+
+std::string parseXmlJs(ParsedContext& result, const std::string& fileContent) {
+    return runParser([&]() { parseXml(result, fileContent); });
+}
+
+std::vector<std::string> getParsedContextObjects(const ParsedContext& result) {
+    return result.context.getObjectsCopy();
+}
+
+std::vector<std::string> getParsedContextAttributes(const ParsedContext& result) {
+    return result.context.getAttributesCopy();
+}
+
+emscripten::val getParsedContextMatrixView(ParsedContext& result) {
+    auto& contextMatrix = result.context.getContext();
+    return emscripten::val(emscripten::typed_memory_view(contextMatrix.size(), contextMatrix.data()));
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef PARSERS_H
+#define PARSERS_H
+
+#include "types/FormalContext.h"
+#include "types/ParsedContext.h"
+#include <string>
+#include <vector>
+#include <emscripten/val.h>
+
+// The parsers report issues with the file format by exceptions,
+// their messages are returned to JavaScript as strings, an empty string means success.
+
+std::string parseBurmeisterJs(ParsedContext& result, const std::string& fileContent, bool parallelize);
+
+std::string parseCsvJs(ParsedContext& result, const std::string& fileContent, const std::string& separator);
+
+std::string parseJsonJs(ParsedContext& result, const std::string& fileContent);
+
+std::string parseXmlJs(ParsedContext& result, const std::string& fileContent);
+
+std::vector<std::string> getParsedContextObjects(const ParsedContext& result);
+
+std::vector<std::string> getParsedContextAttributes(const ParsedContext& result);
+
+/**
+ * Returns a view of the context matrix in the wasm memory, so that it can be copied to JavaScript at once.
+ * The view is valid only until the memory grows or the result is deleted.
+ */
+emscripten::val getParsedContextMatrixView(ParsedContext& result);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include "types/FormalContext.h"
+#include "types/FormalConcept.h"
+#include "projectFile.h"
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+#define PROJECT_FILE_MAGIC "KNLT"
+#define PROJECT_FILE_HEADER_SIZE 16
+#define PROJECT_FILE_SECTION_ENTRY_SIZE 24
+#define PROJECT_FILE_SECTION_ALIGNMENT 8
+
+void appendUInt32(std::string& bytes, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        bytes.push_back((char)((value >> (i * 8)) & 0xFF));
+    }
+}
+
+void appendUInt64(std::string& bytes, uint64_t value) {
+    appendUInt32(bytes, (uint32_t)(value & 0xFFFFFFFF));
+    appendUInt32(bytes, (uint32_t)(value >> 32));
+}
+
+void appendPadding(std::string& bytes, size_t alignment) {
+    bytes.append((alignment - (bytes.size() % alignment)) % alignment, '\0');
+}
+
+/// @brief Appends offsets of the lists and then the concatenated lists.
+template <typename Lists>
+void appendLists(std::string& bytes, const Lists& lists) {
+    uint32_t offset = 0;
+    appendUInt32(bytes, offset);
+
+    for (auto& list : lists) {
+        offset += list.size();
+        appendUInt32(bytes, offset);
+    }
+
+    for (auto& list : lists) {
+        for (int value : list) {
+            appendUInt32(bytes, value);
+        }
+    }
+}
+
+void ProjectFileWriter::addContext(FormalContext& context, const std::string& name) {
+    auto& objects = context.getObjects();
+    auto& attributes = context.getAttributes();
+    std::string names;
+    std::string strings = name;
+
+    appendUInt32(names, objects.size());
+    appendUInt32(names, attributes.size());
+    appendUInt32(names, 0);
+    appendUInt32(names, strings.size());
+
+    for (auto* list : { &objects, &attributes }) {
+        for (auto& value : *list) {
+            strings.append(value);
+            appendUInt32(names, strings.size());
+        }
+    }
+
+    names.append(strings);
+    sections.push_back({ ProjectSectionType::Names, std::move(names) });
+
+    std::string matrix;
+    appendUInt32(matrix, objects.size());
+    appendUInt32(matrix, attributes.size());
+    appendUInt32(matrix, context.getCellSize());
+    appendUInt32(matrix, context.getCellsPerObject());
+
+    for (unsigned int cell : context.getContext()) {
+        appendUInt32(matrix, cell);
+    }
+
+    sections.push_back({ ProjectSectionType::Context, std::move(matrix) });
+}
+
+void ProjectFileWriter::addConcepts(std::vector<SimpleFormalConcept>& concepts) {
+    std::vector<std::vector<int>*> extents;
+    std::vector<std::vector<int>*> intents;
+
+    for (auto& concept : concepts) {
+        extents.push_back(&concept.getObjects());
+        intents.push_back(&concept.getAttributes());
+    }
+
+    std::string bytes;
+    appendUInt32(bytes, concepts.size());
+
+    // The lists are appended through pointers, so that the concepts are not copied
+    uint32_t offset = 0;
+    for (auto* lists : { &extents, &intents }) {
+        offset = 0;
+        appendUInt32(bytes, offset);
+
+        for (auto* list : *lists) {
+            offset += list->size();
+            appendUInt32(bytes, offset);
+        }
+
+        for (auto* list : *lists) {
+            for (int value : *list) {
+                appendUInt32(bytes, value);
+            }
+        }
+    }
+
+    sections.push_back({ ProjectSectionType::Concepts, std::move(bytes) });
+}
+
+void ProjectFileWriter::addCover(const std::vector<std::vector<int>>& subconceptsMapping) {
+    std::string bytes;
+    appendUInt32(bytes, subconceptsMapping.size());
+    appendLists(bytes, subconceptsMapping);
+
+    sections.push_back({ ProjectSectionType::Cover, std::move(bytes) });
+}
+
+void ProjectFileWriter::addLayout(const std::string& key, const std::vector<float>& coordinates) {
+    std::string bytes;
+    appendUInt32(bytes, coordinates.size() / 3);
+    appendUInt32(bytes, key.size());
+    bytes.append(key);
+    appendPadding(bytes, 4);
+
+    for (float coordinate : coordinates) {
+        uint32_t bits;
+        std::memcpy(&bits, &coordinate, sizeof(bits));
+        appendUInt32(bytes, bits);
+    }
+
+    sections.push_back({ ProjectSectionType::Layout, std::move(bytes) });
+}
+
+std::string ProjectFileWriter::write() const {
+    std::string bytes(PROJECT_FILE_MAGIC);
+    appendUInt32(bytes, PROJECT_FILE_VERSION);
+    appendUInt32(bytes, sections.size());
+    appendUInt32(bytes, 0);
+
+    uint64_t offset = PROJECT_FILE_HEADER_SIZE + (sections.size() * PROJECT_FILE_SECTION_ENTRY_SIZE);
+
+    for (auto& [type, section] : sections) {
+        offset += (PROJECT_FILE_SECTION_ALIGNMENT - (offset % PROJECT_FILE_SECTION_ALIGNMENT)) % PROJECT_FILE_SECTION_ALIGNMENT;
+
+        appendUInt32(bytes, (uint32_t)type);
+        appendUInt32(bytes, 0);
+        appendUInt64(bytes, offset);
+        appendUInt64(bytes, section.size());
+
+        offset += section.size();
+    }
+
+    for (auto& [type, section] : sections) {
+        appendPadding(bytes, PROJECT_FILE_SECTION_ALIGNMENT);
+        bytes.append(section);
+    }
+
+    return bytes;
+}
+
+void ProjectFileWriter::writeToFile(const std::string& filePath) const {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create the project file " + filePath);
+    }
+
+    std::string bytes = write();
+    file.write(bytes.data(), bytes.size());
+
+    if (!file.good()) {
+        throw std::runtime_error("Cannot write the project file " + filePath);
+    }
+}
\ No newline at end of file
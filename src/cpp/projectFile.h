@@ -0,0 +1,68 @@
+#ifndef PROJECT_FILE_H
+#define PROJECT_FILE_H
+
+#include "types/FormalContext.h"
+#include "types/FormalConcept.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Project file (.konlatt) with a precomputed context, concepts, cover relation and layouts:
+//
+// char[4]  magic "KNLT"
+// uint32   format version
+// uint32   sections count
+// uint32   reserved (0)
+// section table, for each section:
+//   uint32   section type
+//   uint32   reserved (0)
+//   uint64   offset of the section from the start of the file
+//   uint64   size of the section in bytes
+// sections, each starting at an offset aligned to 8 bytes, so that typed arrays can view them directly
+//
+// Names (1):     uint32 objects count, uint32 attributes count,
+//                uint32 offsets of (1 + objects count + attributes count + 1) strings into the following UTF-8 bytes,
+//                the first string is the name of the context
+// Context (2):   uint32 objects count, uint32 attributes count, uint32 cell size, uint32 cells per object,
+//                uint32 cells of the context matrix
+// Concepts (3):  uint32 concepts count, uint32 offsets of (concepts count + 1) extents, uint32 objects of all extents,
+//                uint32 offsets of (concepts count + 1) intents, uint32 attributes of all intents
+// Cover (4):     uint32 concepts count, uint32 offsets of (concepts count + 1) subconcept lists, uint32 subconcepts
+// Layout (5):    uint32 concepts count, uint32 key length, key bytes padded to 4 bytes,
+//                float32 x, y, z coordinates of all concepts
+//
+// All numbers are stored in little-endian byte order. Sections of unknown types are skipped by readers,
+// so new sections do not require a new version. A file may contain several layouts with different keys.
+//
+// The files are read in the browser by src/services/projectFile.ts.
+
+#define PROJECT_FILE_VERSION 1
+#define PROJECT_FILE_EXTENSION ".konlatt"
+
+enum class ProjectSectionType : uint32_t {
+    Names = 1,
+    Context = 2,
+    Concepts = 3,
+    Cover = 4,
+    Layout = 5,
+};
+
+class ProjectFileWriter {
+public:
+    void addContext(FormalContext& context, const std::string& name);
+    void addConcepts(std::vector<SimpleFormalConcept>& concepts);
+    /// @param subconceptsMapping Subconcepts of each concept.
+    void addCover(const std::vector<std::vector<int>>& subconceptsMapping);
+    /// @param key Identifies the options the layout was computed with.
+    /// @param coordinates x, y, z coordinates of all concepts.
+    void addLayout(const std::string& key, const std::vector<float>& coordinates);
+
+    std::string write() const;
+    /// @throws std::runtime_error if the file cannot be written.
+    void writeToFile(const std::string& filePath) const;
+
+private:
+    std::vector<std::pair<ProjectSectionType, std::string>> sections;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "types/FormalContext.h"
+#include "syntheticContext.h"
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+void setSyntheticAttribute(std::vector<unsigned int>& contextMatrix, int cellSize, int cellsPerObject, int object, int attribute) {
+    contextMatrix[(object * cellsPerObject) + (attribute / cellSize)] |= 1u << (attribute % cellSize);
+}
+
+/// @brief Picks count distinct random elements of [0, total).
+std::vector<int> sampleIndexes(std::mt19937& generator, int total, int count) {
+    std::vector<int> indexes(total);
+    std::iota(indexes.begin(), indexes.end(), 0);
+
+    count = std::min(count, total);
+
+    // Partial Fisher–Yates shuffle
+    for (int i = 0; i < count; i++) {
+        std::uniform_int_distribution<int> distribution(i, total - 1);
+        std::swap(indexes[i], indexes[distribution(generator)]);
+    }
+
+    indexes.resize(count);
+    return indexes;
+}
+
+FormalContext generateSyntheticContext(const SyntheticContextOptions& options) {
+    FormalContext context;
+    std::mt19937 generator(options.seed);
+    std::bernoulli_distribution densityDistribution(std::clamp(options.density, 0.0, 1.0));
+    std::bernoulli_distribution correlationDistribution(std::clamp(options.correlation, 0.0, 1.0));
+
+    int cellSize = sizeof(unsigned int) * 8;
+    int cellsPerObject = (int)ceil(options.attributesCount / (double)cellSize);
+
+    std::vector<std::string> objects;
+    std::vector<std::string> attributes;
+    std::vector<unsigned int> contextMatrix(options.objectsCount * cellsPerObject, 0u);
+
+    for (int object = 0; object < options.objectsCount; object++) {
+        objects.push_back("o" + std::to_string(object));
+
+        bool previousValue = densityDistribution(generator);
+
+        for (int attribute = 0; attribute < options.attributesCount; attribute++) {
+            // Copying the previous value keeps the expected density unchanged
+            bool value = attribute > 0 && correlationDistribution(generator) ?
+                previousValue :
+                densityDistribution(generator);
+
+            if (value) {
+                setSyntheticAttribute(contextMatrix, cellSize, cellsPerObject, object, attribute);
+            }
+
+            previousValue = value;
+        }
+    }
+
+    for (int attribute = 0; attribute < options.attributesCount; attribute++) {
+        attributes.push_back("a" + std::to_string(attribute));
+    }
+
+    for (int i = 0; i < options.plantedConceptsCount; i++) {
+        auto conceptObjects = sampleIndexes(generator, options.objectsCount, options.plantedConceptObjectsCount);
+        auto conceptAttributes = sampleIndexes(generator, options.attributesCount, options.plantedConceptAttributesCount);
+
+        for (int object : conceptObjects) {
+            for (int attribute : conceptAttributes) {
+                setSyntheticAttribute(contextMatrix, cellSize, cellsPerObject, object, attribute);
+            }
+        }
+    }
+
+    context.setObjects(objects);
+    context.setAttributes(attributes);
+    context.setCellsPerObject(cellsPerObject);
+    context.setCellSize(cellSize);
+    context.setContext(contextMatrix);
+
+    return context;
+}
+
+std::string writeBurmeister(FormalContext& context, const std::string& name) {
+    auto& objects = context.getObjects();
+    auto& attributes = context.getAttributes();
+    auto& contextMatrix = context.getContext();
+    int cellSize = context.getCellSize();
+    int cellsPerObject = context.getCellsPerObject();
+
+    std::string content = "B\n" + name + "\n" +
+        std::to_string(objects.size()) + "\n" +
+        std::to_string(attributes.size()) + "\n\n";
+
+    for (auto& object : objects) {
+        content += object + "\n";
+    }
+
+    for (auto& attribute : attributes) {
+        content += attribute + "\n";
+    }
+
+    for (int object = 0; object < objects.size(); object++) {
+        for (int attribute = 0; attribute < attributes.size(); attribute++) {
+            unsigned int cell = contextMatrix[(object * cellsPerObject) + (attribute / cellSize)];
+            content += (cell & (1u << (attribute % cellSize))) ? 'X' : '.';
+        }
+
+        content += "\n";
+    }
+
+    return content;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef SYNTHETIC_CONTEXT_H
+#define SYNTHETIC_CONTEXT_H
+
+#include "types/FormalContext.h"
+#include <string>
+
+/// @brief Parameters of a randomly generated formal context.
+struct SyntheticContextOptions {
+    int objectsCount = 100;
+    int attributesCount = 50;
+    /// @brief Probability that an object has an attribute.
+    double density = 0.1;
+    /// @brief Probability that an object has the same value of an attribute as of the previous attribute.
+    /// Correlated attributes produce longer chains of concepts than independent ones.
+    double correlation = 0.0;
+    /// @brief Number of rectangles of incidences (concepts) that are placed over the random noise.
+    int plantedConceptsCount = 0;
+    int plantedConceptObjectsCount = 0;
+    int plantedConceptAttributesCount = 0;
+    unsigned int seed = 42;
+};
+
+/**
+ * Generates a random formal context in the packed format of parseBurmeister().
+ *
+ * The same options always produce the same context.
+ */
+FormalContext generateSyntheticContext(const SyntheticContextOptions& options);
+
+/**
+ * Writes a formal context in the Burmeister (.cxt) format.
+ */
+std::string writeBurmeister(FormalContext& context, const std::string& name);
+
+#endif
\ No newline at end of file
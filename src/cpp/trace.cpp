@@ -0,0 +1,127 @@
+#include "trace.h"
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+
+struct TraceEvent {
+    const char* name;
+    long long startTime;
+    long long duration;
+    int threadIndex;
+};
+
+struct TraceCounter {
+    const char* name;
+    std::atomic<long long> value;
+
+    TraceCounter(const char* name) : name(name), value(0) {}
+};
+
+std::mutex traceMutex;
+std::vector<TraceEvent> traceEvents;
+// Deque keeps the references to the counters valid when new counters are registered
+std::deque<TraceCounter> traceCounters;
+std::chrono::steady_clock::time_point traceStartTime = std::chrono::steady_clock::now();
+std::atomic<int> nextTraceThreadIndex(0);
+
+int currentTraceThreadIndex() {
+    thread_local int threadIndex = nextTraceThreadIndex.fetch_add(1);
+    return threadIndex;
+}
+
+long long nanosecondsSinceTraceStart(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - traceStartTime).count();
+}
+
+TraceScope::TraceScope(const char* name) : name(name), startTime(std::chrono::steady_clock::now()) {
+}
+
+TraceScope::~TraceScope() {
+    auto endTime = std::chrono::steady_clock::now();
+    int threadIndex = currentTraceThreadIndex();
+
+    std::lock_guard<std::mutex> lock(traceMutex);
+
+    traceEvents.push_back({
+        name,
+        nanosecondsSinceTraceStart(startTime),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count(),
+        threadIndex });
+}
+
+std::atomic<long long>& registerTraceCounter(const char* name) {
+    std::lock_guard<std::mutex> lock(traceMutex);
+
+    for (auto& counter : traceCounters) {
+        if (std::string(counter.name) == name) {
+            return counter.value;
+        }
+    }
+
+    traceCounters.emplace_back(name);
+    return traceCounters.back().value;
+}
+
+bool isTraceEnabled() {
+#ifdef KONLATT_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+void resetTrace() {
+    std::lock_guard<std::mutex> lock(traceMutex);
+
+    traceEvents.clear();
+    traceStartTime = std::chrono::steady_clock::now();
+
+    // The counters stay registered, their call sites hold references to them
+    for (auto& counter : traceCounters) {
+        counter.value.store(0);
+    }
+}
+
+std::string exportTraceJson() {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    std::stringstream stream;
+    long long endTime = nanosecondsSinceTraceStart(std::chrono::steady_clock::now());
+
+    stream << std::fixed;
+    stream.precision(3);
+
+    // Timestamps of the format are in microseconds
+    stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+
+    for (auto& event : traceEvents) {
+        stream << (first ? "" : ",")
+            << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadIndex
+            << ",\"ts\":" << event.startTime / 1000.0
+            << ",\"dur\":" << event.duration / 1000.0 << "}";
+        first = false;
+    }
+
+    // Counters are emitted once with their final values, the counters of kernels that did not run are left out
+    for (auto& counter : traceCounters) {
+        if (counter.value.load() == 0) {
+            continue;
+        }
+
+        stream << (first ? "" : ",")
+            << "{\"name\":\"" << counter.name << "\",\"ph\":\"C\",\"pid\":1,\"tid\":0"
+            << ",\"ts\":" << endTime / 1000.0
+            << ",\"args\":{\"value\":" << counter.value.load() << "}}";
+        first = false;
+    }
+
+    stream << "]}";
+
+    return stream.str();
+}
\ No newline at end of file
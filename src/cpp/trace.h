@@ -0,0 +1,64 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <string>
+#include <atomic>
+#include <chrono>
+
+// Instrumentation of the hot paths, enabled by compiling with -DKONLATT_TRACE
+// Without the flag, the macros expand to nothing and the instrumented code stays as fast as before
+
+#ifdef KONLATT_TRACE
+
+#define TRACE_CONCAT_IMPL(first, second) first##second
+#define TRACE_CONCAT(first, second) TRACE_CONCAT_IMPL(first, second)
+
+/// @brief Measures the time from this line to the end of the enclosing scope.
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+
+/// @brief Adds the value to the named counter. The counter is looked up only once per call site.
+#define TRACE_COUNTER(name, value) \
+    do { \
+        static std::atomic<long long>& traceCounter = registerTraceCounter(name); \
+        traceCounter.fetch_add(value, std::memory_order_relaxed); \
+    } while (0)
+
+#else
+
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_COUNTER(name, value) ((void)0)
+
+#endif
+
+/**
+ * Records a complete event of the trace when it goes out of scope.
+ */
+class TraceScope {
+public:
+    TraceScope(const char* name);
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+std::atomic<long long>& registerTraceCounter(const char* name);
+
+bool isTraceEnabled();
+
+/**
+ * Clears the recorded events and counters.
+ */
+void resetTrace();
+
+/**
+ * Exports the recorded events and counters in the Chrome trace event format,
+ * which can be opened in chrome://tracing or https://ui.perfetto.dev.
+ */
+std::string exportTraceJson();
+
+#endif
\ No newline at end of file
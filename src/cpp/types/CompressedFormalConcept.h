@@ -0,0 +1,30 @@
+#ifndef COMPRESSED_FORMAL_CONCEPT_H
+#define COMPRESSED_FORMAL_CONCEPT_H
+
+#include "../compressedExtent.h"
+#include <vector>
+
+// Formal concept whose extent is compressed, for contexts with many objects where the extents dominate the memory
+
+class CompressedFormalConcept {
+public:
+    CompressedFormalConcept() {}
+
+    int getAttribute() const { return attribute; }
+    void setAttribute(int value) { attribute = value; }
+
+    CompressedExtent& getObjects() { return objects; }
+    std::vector<int> getObjectsCopy() const { return objects.toVector(); }
+    void setObjects(CompressedExtent value) { objects = std::move(value); }
+
+    std::vector<int>& getAttributes() { return attributes; }
+    std::vector<int> getAttributesCopy() const { return attributes; }
+    void setAttributes(std::vector<int>& value) { attributes = value; }
+
+private:
+    CompressedExtent objects;
+    std::vector<int> attributes;
+    int attribute;
+};
+
+#endif
\ No newline at end of file
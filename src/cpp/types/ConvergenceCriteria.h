@@ -0,0 +1,21 @@
+#ifndef CONVERGENCE_CRITERIA_H
+#define CONVERGENCE_CRITERIA_H
+
+/// @brief Criteria for stopping iterative layouts before they reach their iterations cap.
+/// Values less than or equal to zero disable the corresponding criterion.
+struct ConvergenceCriteria {
+    /// @brief Stop when no node moves further than this distance in an iteration.
+    float maxDisplacement;
+    /// @brief Stop when the relative change of the total displacement between two iterations is smaller than this value.
+    float energyDelta;
+    /// @brief Stop when the whole layout computation takes longer than this number of milliseconds.
+    int timeBudget;
+
+    ConvergenceCriteria(float maxDisplacement, float energyDelta, int timeBudget) :
+        maxDisplacement(maxDisplacement),
+        energyDelta(energyDelta),
+        timeBudget(timeBudget) {}
+    ConvergenceCriteria() : ConvergenceCriteria(0, 0, 0) {}
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef IMPLICATION_H
+#define IMPLICATION_H
+
+#include <vector>
+
+class Implication {
+public:
+    Implication() {}
+
+    std::vector<int>& getPremise() { return premise; }
+    std::vector<int> getPremiseCopy() const { return premise; }
+    void setPremise(std::vector<int>& value) { premise = value; }
+
+    std::vector<int>& getConclusion() { return conclusion; }
+    std::vector<int> getConclusionCopy() const { return conclusion; }
+    void setConclusion(std::vector<int>& value) { conclusion = value; }
+
+private:
+    std::vector<int> premise;
+    std::vector<int> conclusion;
+};
+
+#endif
\ No newline at end of file
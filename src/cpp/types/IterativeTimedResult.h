@@ -0,0 +1,15 @@
+#ifndef ITERATIVE_TIMED_RESULT_H
+#define ITERATIVE_TIMED_RESULT_H
+
+#include "TimedResult.h"
+#include <string>
+
+template <typename T>
+struct IterativeTimedResult : TimedResult<T> {
+    int iterationsCount;
+    std::string stopReason;
+
+    IterativeTimedResult() : TimedResult<T>(), iterationsCount(0) {}
+};
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <cstddef>
+
+/// @brief Heap usage of a single computation stage.
+struct MemoryUsage {
+    /// @brief Total number of bytes allocated by the stage, including the memory that has been freed since.
+    size_t allocatedBytes;
+    /// @brief Highest number of bytes held by the stage at once, on top of the memory held before the stage.
+    size_t peakBytes;
+    /// @brief Number of allocations made by the stage.
+    size_t allocationsCount;
+
+    MemoryUsage() : allocatedBytes(0), peakBytes(0), allocationsCount(0) {}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef PARSED_CONTEXT_H
+#define PARSED_CONTEXT_H
+
+#include "FormalContext.h"
+#include <string>
+
+/// @brief Formal context read from a file together with the data stored next to it.
+struct ParsedContext {
+    FormalContext context;
+    std::string name;
+    bool hasName = false;
+    /// @brief The file stores concepts instead of a relation, so the context is not filled.
+    bool hasConcepts = false;
+};
+
+#endif
\ No newline at end of file
@@ -1,10 +1,13 @@
 #ifndef TIMED_RESULT_H
 #define TIMED_RESULT_H
 
+#include "MemoryUsage.h"
+
 template <typename T>
 struct TimedResult {
     T value;
     int time;
+    MemoryUsage memory;
 
     TimedResult(T value, int time) : value(value), time(time) {}
     TimedResult() {}
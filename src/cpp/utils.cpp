@@ -9,6 +9,7 @@
 #include <vector>
 #include <string>
 #include <unordered_set>
+#include <cstdint>
 
 long long nowMills() {
     auto now = std::chrono::system_clock::now();
@@ -54,6 +55,27 @@ bool hasObjectWithAllAttributes(
     return false;
 }
 
+std::vector<uint64_t> getAttributeBitsets(
+    std::vector<unsigned int>& contextMatrix,
+    int cellSize,
+    int cellsPerObject,
+    int objectsCount,
+    int attributesCount
+) {
+    size_t wordsCount = (objectsCount + 63) / 64;
+    std::vector<uint64_t> attributeBitsets(wordsCount * attributesCount, 0);
+
+    for (int object = 0; object < objectsCount; object++) {
+        for (int attribute = 0; attribute < attributesCount; attribute++) {
+            if (formalContextHasAttribute(contextMatrix, cellSize, cellsPerObject, object, attribute)) {
+                attributeBitsets[(attribute * wordsCount) + (object >> 6)] |= 1ULL << (object & 63);
+            }
+        }
+    }
+
+    return attributeBitsets;
+}
+
 bool isSortedSubsetOf(std::vector<int>& subset, std::vector<int>& superset) {
     int i = 0;
     int j = 0;
@@ -135,7 +157,7 @@ void printSimpleFormalConcepts(std::vector<SimpleFormalConcept>& concepts) {
 int maxSizeOfSets(std::vector<std::unordered_set<int>>& sets) {
     int maximum = 0;
 
-    for (auto item : sets) {
+    for (auto& item : sets) {
         maximum = std::max(maximum, (int)item.size());
     }
 
@@ -145,7 +167,7 @@ int maxSizeOfSets(std::vector<std::unordered_set<int>>& sets) {
 int maxSizeOfVectors(std::vector<std::vector<int>>& vectors) {
     int maximum = 0;
 
-    for (auto item : vectors) {
+    for (auto& item : vectors) {
         maximum = std::max(maximum, (int)item.size());
     }
 
@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include <unordered_set>
+#include <cstdint>
 
 bool formalContextHasAttribute(
     std::vector<unsigned int> &contextMatrix,
@@ -19,6 +20,17 @@ bool hasObjectWithAllAttributes(
     int objectsCount,
     int attributesCount);
 
+/**
+ * @returns Bitsets of the objects of each attribute, i.e. the transposed context matrix.
+ * The bitset of each attribute takes (objectsCount + 63) / 64 words.
+ */
+std::vector<uint64_t> getAttributeBitsets(
+    std::vector<unsigned int>& contextMatrix,
+    int cellSize,
+    int cellsPerObject,
+    int objectsCount,
+    int attributesCount);
+
 bool isSortedSubsetOf(std::vector<int>& subset, std::vector<int>& superset);
 
 template <typename T>
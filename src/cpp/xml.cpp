@@ -0,0 +1,512 @@
+#include "types/ParsedContext.h"
+#include "contextParsing.h"
+#include "xml.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <cstdlib>
+#include <cctype>
+#include <stdexcept>
+
+enum class XmlNodeType {
+    StartElement,
+    EndElement,
+    Text,
+    End,
+};
+
+/// @brief Names of a formal context as they are read from the file.
+struct XmlNames {
+    std::vector<std::string> values;
+    bool allValid = true;
+};
+
+bool isXmlWhitespace(char character) {
+    return character == ' ' || character == '\n' || character == '\r' || character == '\t';
+}
+
+void appendUtf8(std::string& value, unsigned long codePoint) {
+    if (codePoint < 0x80) {
+        value.push_back((char)codePoint);
+    }
+    else if (codePoint < 0x800) {
+        value.push_back((char)(0xC0 | (codePoint >> 6)));
+        value.push_back((char)(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000) {
+        value.push_back((char)(0xE0 | (codePoint >> 12)));
+        value.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back((char)(0x80 | (codePoint & 0x3F)));
+    }
+    else {
+        value.push_back((char)(0xF0 | (codePoint >> 18)));
+        value.push_back((char)(0x80 | ((codePoint >> 12) & 0x3F)));
+        value.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back((char)(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+/// @brief Appends the text with the predefined and numeric entities replaced, unknown entities are kept as they are.
+void appendXmlText(std::string& value, std::string_view text) {
+    size_t position = 0;
+
+    while (position < text.size()) {
+        size_t ampersand = text.find('&', position);
+        value.append(text.substr(position, ampersand == std::string_view::npos ? std::string_view::npos : ampersand - position));
+
+        if (ampersand == std::string_view::npos) {
+            return;
+        }
+
+        size_t semicolon = text.find(';', ampersand);
+        std::string_view entity = semicolon == std::string_view::npos ?
+            std::string_view() :
+            text.substr(ampersand + 1, semicolon - ampersand - 1);
+        position = semicolon == std::string_view::npos ? text.size() : semicolon + 1;
+
+        if (entity == "lt") value.push_back('<');
+        else if (entity == "gt") value.push_back('>');
+        else if (entity == "amp") value.push_back('&');
+        else if (entity == "quot") value.push_back('"');
+        else if (entity == "apos") value.push_back('\'');
+        else if (entity.size() > 1 && entity[0] == '#') {
+            bool hexadecimal = entity[1] == 'x' || entity[1] == 'X';
+            std::string digits(entity.substr(hexadecimal ? 2 : 1));
+            char* digitsEnd = nullptr;
+            unsigned long codePoint = std::strtoul(digits.c_str(), &digitsEnd, hexadecimal ? 16 : 10);
+
+            if (!digits.empty() && *digitsEnd == '\0' && codePoint <= 0x10FFFF) {
+                appendUtf8(value, codePoint);
+            }
+            else {
+                value.append(text.substr(ampersand, position - ampersand));
+            }
+        }
+        else {
+            position = ampersand + 1;
+            value.push_back('&');
+        }
+    }
+}
+
+std::string_view trimmedXmlText(std::string_view value) {
+    while (!value.empty() && isXmlWhitespace(value.front())) {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && isXmlWhitespace(value.back())) {
+        value.remove_suffix(1);
+    }
+    return value;
+}
+
+/// @brief Forward-only reader of the nodes of an XML document.
+/// Comments, processing instructions and the document type declaration are skipped.
+class XmlReader {
+public:
+    XmlReader(std::string_view content) : content(content), position(0) {}
+
+    XmlNodeType read() {
+        while (true) {
+            if (position >= content.size()) {
+                if (!openElements.empty()) {
+                    fail();
+                }
+                return XmlNodeType::End;
+            }
+
+            if (content[position] != '<') {
+                size_t end = content.find('<', position);
+                end = end == std::string_view::npos ? content.size() : end;
+                text = content.substr(position, end - position);
+                isCData = false;
+                position = end;
+                return XmlNodeType::Text;
+            }
+
+            std::string_view rest = content.substr(position);
+
+            if (rest.substr(0, 4) == "<!--") {
+                skipPast("-->");
+            }
+            else if (rest.substr(0, 9) == "<![CDATA[") {
+                size_t end = content.find("]]>", position + 9);
+
+                if (end == std::string_view::npos) {
+                    fail();
+                }
+
+                text = content.substr(position + 9, end - position - 9);
+                isCData = true;
+                position = end + 3;
+                return XmlNodeType::Text;
+            }
+            else if (rest.substr(0, 2) == "<?") {
+                skipPast("?>");
+            }
+            else if (rest.substr(0, 2) == "<!") {
+                skipDeclaration();
+            }
+            else if (rest.substr(0, 2) == "</") {
+                readEndTag();
+                return XmlNodeType::EndElement;
+            }
+            else {
+                readStartTag();
+                return XmlNodeType::StartElement;
+            }
+        }
+    }
+
+    std::string_view getName() const { return name; }
+
+    /// @brief Whether the last start element is closed by itself (<element />), no end element follows then.
+    bool isEmptyElement() const { return isEmpty; }
+
+    /// @brief Appends the decoded content of the last text node.
+    void appendText(std::string& value) const {
+        if (isCData) {
+            value.append(text);
+        }
+        else {
+            appendXmlText(value, text);
+        }
+    }
+
+    /// @brief Finds an attribute of the last start element.
+    bool getAttribute(std::string_view attributeName, std::string& value) const {
+        size_t position = 0;
+
+        while (position < attributes.size()) {
+            while (position < attributes.size() && isXmlWhitespace(attributes[position])) {
+                position++;
+            }
+
+            size_t nameStart = position;
+
+            while (position < attributes.size() && attributes[position] != '=' && !isXmlWhitespace(attributes[position])) {
+                position++;
+            }
+
+            std::string_view currentName = attributes.substr(nameStart, position - nameStart);
+            size_t quote = attributes.find_first_of("\"'", position);
+
+            if (quote == std::string_view::npos) {
+                return false;
+            }
+
+            size_t valueEnd = attributes.find(attributes[quote], quote + 1);
+
+            if (valueEnd == std::string_view::npos) {
+                return false;
+            }
+
+            if (currentName == attributeName) {
+                value.clear();
+                appendXmlText(value, attributes.substr(quote + 1, valueEnd - quote - 1));
+                return true;
+            }
+
+            position = valueEnd + 1;
+        }
+
+        return false;
+    }
+
+    /// @brief Skips the content of the last start element including its end element.
+    void skipElement() {
+        if (isEmpty) {
+            return;
+        }
+
+        size_t depth = openElements.size();
+
+        while (true) {
+            XmlNodeType type = read();
+
+            if (type == XmlNodeType::End) {
+                fail();
+            }
+            if (type == XmlNodeType::EndElement && openElements.size() < depth) {
+                return;
+            }
+        }
+    }
+
+    [[noreturn]] void fail() {
+        throw std::invalid_argument("The file is not a well-formed XML document.");
+    }
+
+private:
+    std::string_view content;
+    size_t position;
+    std::vector<std::string_view> openElements;
+    std::string_view name;
+    std::string_view attributes;
+    std::string_view text;
+    bool isEmpty = false;
+    bool isCData = false;
+
+    void skipPast(std::string_view terminator) {
+        size_t end = content.find(terminator, position);
+
+        if (end == std::string_view::npos) {
+            fail();
+        }
+
+        position = end + terminator.size();
+    }
+
+    void skipDeclaration() {
+        // The document type declaration may contain an internal subset in brackets
+        int bracketsDepth = 0;
+
+        for (position += 2; position < content.size(); position++) {
+            char character = content[position];
+
+            if (character == '[') {
+                bracketsDepth++;
+            }
+            else if (character == ']') {
+                bracketsDepth--;
+            }
+            else if (character == '>' && bracketsDepth <= 0) {
+                position++;
+                return;
+            }
+        }
+
+        fail();
+    }
+
+    void readStartTag() {
+        size_t nameStart = ++position;
+
+        while (position < content.size() && !isXmlWhitespace(content[position]) && content[position] != '/' && content[position] != '>') {
+            position++;
+        }
+
+        name = content.substr(nameStart, position - nameStart);
+        size_t attributesStart = position;
+        char quote = '\0';
+
+        // Quoted attribute values may contain '>' and '/'
+        for (; position < content.size(); position++) {
+            char character = content[position];
+
+            if (quote != '\0') {
+                quote = character == quote ? '\0' : quote;
+            }
+            else if (character == '"' || character == '\'') {
+                quote = character;
+            }
+            else if (character == '>') {
+                break;
+            }
+        }
+
+        if (name.empty() || position >= content.size()) {
+            fail();
+        }
+
+        isEmpty = content[position - 1] == '/';
+        attributes = content.substr(attributesStart, position - attributesStart - (isEmpty ? 1 : 0));
+        position++;
+
+        if (!isEmpty) {
+            openElements.push_back(name);
+        }
+    }
+
+    void readEndTag() {
+        size_t end = content.find('>', position);
+
+        if (end == std::string_view::npos) {
+            fail();
+        }
+
+        name = trimmedXmlText(content.substr(position + 2, end - position - 2));
+        position = end + 1;
+
+        if (openElements.empty() || openElements.back() != name) {
+            fail();
+        }
+
+        openElements.pop_back();
+    }
+};
+
+/// @brief Reads the text of the last start element, values with nested elements are not valid.
+bool readXmlValue(XmlReader& reader, std::string& value) {
+    value.clear();
+
+    if (reader.isEmptyElement()) {
+        return true;
+    }
+
+    bool valid = true;
+
+    while (true) {
+        switch (reader.read()) {
+            case XmlNodeType::Text:
+                reader.appendText(value);
+                break;
+            case XmlNodeType::StartElement:
+                valid = false;
+                reader.skipElement();
+                break;
+            case XmlNodeType::EndElement:
+                value = std::string(trimmedXmlText(value));
+                return valid;
+            case XmlNodeType::End:
+                reader.fail();
+        }
+    }
+}
+
+/// @brief Calls onChild for each child element of the last start element, onChild has to read the whole child.
+template <typename F>
+void readXmlChildren(XmlReader& reader, F onChild) {
+    if (reader.isEmptyElement()) {
+        return;
+    }
+
+    while (true) {
+        switch (reader.read()) {
+            case XmlNodeType::Text:
+                break;
+            case XmlNodeType::StartElement:
+                onChild(reader.getName());
+                break;
+            case XmlNodeType::EndElement:
+                return;
+            case XmlNodeType::End:
+                reader.fail();
+        }
+    }
+}
+
+void readXmlNames(XmlReader& reader, std::string_view elementName, XmlNames& names) {
+    names = XmlNames();
+    std::string value;
+
+    readXmlChildren(reader, [&](std::string_view childName) {
+        if (childName != elementName) {
+            reader.skipElement();
+            return;
+        }
+
+        names.allValid &= readXmlValue(reader, value);
+        names.values.push_back(value);
+    });
+}
+
+/// @brief Reads the <rel obj="..." attr="..." /> elements of a relation.
+/// @return Whether all the elements have both indexes.
+bool readXmlRelation(XmlReader& reader, std::vector<std::pair<int, int>>& relation) {
+    bool valid = true;
+    std::string object;
+    std::string attribute;
+
+    readXmlChildren(reader, [&](std::string_view childName) {
+        if (childName == "rel") {
+            if (reader.getAttribute("obj", object) && reader.getAttribute("attr", attribute)) {
+                relation.push_back({ parseIndex(object), parseIndex(attribute) });
+            }
+            else {
+                valid = false;
+            }
+        }
+
+        reader.skipElement();
+    });
+
+    return valid;
+}
+
+void validateXmlNames(const XmlNames& names, const std::string& missingMessage, const std::string& invalidMessage) {
+    if (names.values.empty()) {
+        throw std::invalid_argument(missingMessage);
+    }
+    if (!names.allValid) {
+        throw std::invalid_argument(invalidMessage);
+    }
+}
+
+void parseXml(ParsedContext& result, std::string_view fileContent) {
+    XmlReader reader(fileContent);
+    XmlNames objects;
+    XmlNames attributes;
+    std::vector<std::pair<int, int>> relation;
+    bool hasObjects = false;
+    bool hasAttributes = false;
+    bool hasRelation = false;
+    bool hasConcepts = false;
+    bool isRelationValid = true;
+    XmlNodeType type;
+
+    while ((type = reader.read()) == XmlNodeType::Text) {
+        // Whitespace before the root element
+    }
+
+    if (type != XmlNodeType::StartElement || reader.getName() != "context") {
+        throw std::invalid_argument("The file does not contain a formal context.");
+    }
+
+    result.hasName = reader.getAttribute("name", result.name);
+
+    readXmlChildren(reader, [&](std::string_view childName) {
+        if (childName == "objects") {
+            hasObjects = true;
+            readXmlNames(reader, "obj", objects);
+        }
+        else if (childName == "attributes") {
+            hasAttributes = true;
+            readXmlNames(reader, "attr", attributes);
+        }
+        else if (childName == "relation") {
+            hasRelation = true;
+            isRelationValid &= readXmlRelation(reader, relation);
+        }
+        else {
+            hasConcepts |= childName == "concepts";
+            reader.skipElement();
+        }
+    });
+
+    while ((type = reader.read()) == XmlNodeType::Text) {
+        // Whitespace after the root element
+    }
+
+    if (type != XmlNodeType::End) {
+        reader.fail();
+    }
+
+    if (!hasObjects || !hasAttributes || !(hasRelation || hasConcepts)) {
+        throw std::invalid_argument("The file does not contain a formal context.");
+    }
+    if (!hasRelation) {
+        // Files with concepts are parsed together with the concepts and the lattice
+        result.hasConcepts = true;
+        return;
+    }
+
+    validateXmlNames(objects, "Objects are missing.", "Not all objects are valid.");
+    validateXmlNames(attributes, "Attributes are missing.", "Not all attributes are valid.");
+
+    int objectsCount = objects.values.size();
+    int attributesCount = attributes.values.size();
+
+    if (!isRelationValid) {
+        throw std::invalid_argument("Invalid relation format.");
+    }
+
+    for (auto [object, attribute] : relation) {
+        if (object < 0 || object >= objectsCount || attribute < 0 || attribute >= attributesCount) {
+            throw std::invalid_argument("Invalid relation format.");
+        }
+    }
+
+    result.context = createFormalContext(std::move(objects.values), std::move(attributes.values), relation);
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef XML_H
+#define XML_H
+
+#include "types/ParsedContext.h"
+#include <string_view>
+
+/**
+ * Parses an XML file with the objects, attributes and relation of a formal context in a single pass.
+ * The elements are streamed, no document tree is built.
+ *
+ * If the file stores concepts instead of a relation, only result.hasConcepts is set.
+ *
+ * @throws std::invalid_argument if the file is not well-formed XML or does not describe a formal context.
+ */
+void parseXml(ParsedContext& result, std::string_view fileContent);
+
+#endif
\ No newline at end of file
@@ -2,17 +2,27 @@ import { FormalContext } from "../types/FormalContext";
 import Module from "../cpp";
 import { FormalConcept } from "../types/FormalConcepts";
 import { cppFormalConceptArrayToJs, jsArrayToCppUIntArray } from "../utils/cpp";
+import { MemoryUsage } from "../types/MemoryUsage";
+import { formatBytes } from "../utils/numbers";
+
+// Above this count of objects, the extents are stored compressed in wasm while the concepts are computed,
+// which lowers the peak memory, so that larger lattices fit into the wasm memory
+const COMPRESSED_EXTENTS_MIN_OBJECTS = 4096;
 
 export async function computeConcepts(context: FormalContext, onProgress?: (progress: number) => void): Promise<{
     concepts: Array<FormalConcept>,
     computationTime: number,
+    memoryUsage: MemoryUsage,
 }> {
     const module = await Module();
     const uIntContext = jsArrayToCppUIntArray(module, context.context);
-    const result = new module.FormalConceptsTimedResult();
+    const compressExtents = context.objects.length >= COMPRESSED_EXTENTS_MIN_OBJECTS;
+    const result = compressExtents ?
+        new module.CompressedFormalConceptsTimedResult() :
+        new module.FormalConceptsTimedResult();
 
-    module.inClose(
-        result,
+    (compressExtents ? module.inCloseCompressed : module.inClose)(
+        result as any,
         uIntContext,
         context.cellSize,
         context.cellsPerObject,
@@ -22,7 +32,8 @@ export async function computeConcepts(context: FormalContext, onProgress?: (prog
 
     const concepts: Array<FormalConcept> = [...cppFormalConceptArrayToJs(result.value, true)];
     const computationTime = result.time;
-    console.log(`InClose: ${computationTime}ms`);
+    const memoryUsage = result.memory;
+    console.log(`InClose: ${computationTime}ms, peak ${formatBytes(memoryUsage.peakBytes)}`);
 
     uIntContext.delete();
     result.delete();
@@ -30,5 +41,6 @@ export async function computeConcepts(context: FormalContext, onProgress?: (prog
     return {
         concepts,
         computationTime,
+        memoryUsage,
     };
 }
\ No newline at end of file
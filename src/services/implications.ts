@@ -0,0 +1,42 @@
+import { FormalContext } from "../types/FormalContext";
+import Module from "../cpp";
+import { Implication } from "../types/Implication";
+import { cppImplicationArrayToJs, jsArrayToCppUIntArray } from "../utils/cpp";
+import { MemoryUsage } from "../types/MemoryUsage";
+import { formatBytes } from "../utils/numbers";
+
+/**
+ * Computes the Duquenne-Guigues basis of the context, the implications are ordered lectically by their premises.
+ */
+export async function computeImplicationBasis(context: FormalContext, onProgress?: (progress: number) => void): Promise<{
+    implications: Array<Implication>,
+    computationTime: number,
+    memoryUsage: MemoryUsage,
+}> {
+    const module = await Module();
+    const uIntContext = jsArrayToCppUIntArray(module, context.context);
+    const result = new module.ImplicationsTimedResult();
+
+    module.duquenneGuiguesBasis(
+        result,
+        uIntContext,
+        context.cellSize,
+        context.cellsPerObject,
+        context.objects.length,
+        context.attributes.length,
+        onProgress);
+
+    const implications = [...cppImplicationArrayToJs(result.value, true)];
+    const computationTime = result.time;
+    const memoryUsage = result.memory;
+    console.log(`Duquenne-Guigues basis: ${computationTime}ms, peak ${formatBytes(memoryUsage.peakBytes)}`);
+
+    uIntContext.delete();
+    result.delete();
+
+    return {
+        implications,
+        computationTime,
+        memoryUsage,
+    };
+}
\ No newline at end of file
@@ -5,6 +5,8 @@ import { FormalConcept, FormalConcepts, getInfimum, getSupremum } from "../types
 import { FormalContext } from "../types/FormalContext";
 import { cppIntMultiArrayToJs, jsArrayToCppSimpleFormalConceptArray, jsArrayToCppUIntArray } from "../utils/cpp";
 import { breadthFirstSearch } from "../utils/graphs";
+import { formatBytes } from "../utils/numbers";
+import { MemoryUsage } from "../types/MemoryUsage";
 import { assignNodesToLayersByLongestPath } from "./layers";
 
 /**
@@ -15,6 +17,7 @@ import { assignNodesToLayersByLongestPath } from "./layers";
 export async function conceptsToLattice(concepts: FormalConcepts, context: FormalContext, onProgress?: (progress: number) => void): Promise<{
     lattice: ConceptLattice,
     computationTime: number,
+    memoryUsage: MemoryUsage,
 }> {
     const module = await Module();
     const cppConcepts = jsArrayToCppSimpleFormalConceptArray(module, concepts);
@@ -32,13 +35,14 @@ export async function conceptsToLattice(concepts: FormalConcepts, context: Forma
         context.attributes.length,
         onProgress);
 
-    console.log(`ConceptsCover: ${result.time}ms`);
+    console.log(`ConceptsCover: ${result.time}ms, peak ${formatBytes(result.memory.peakBytes)}`);
 
     const superconceptsMapping = [...cppIntMultiArrayToJs(result.value, true)].map((set) => new Set<number>(set));
     const subconceptsMapping = reverseMapping(superconceptsMapping);
     const objectsLabeling = getObjectsLabeling(concepts, superconceptsMapping);
     const attributesLabeling = getAttributesLabeling(concepts, subconceptsMapping);
     const computationTime = result.time;
+    const memoryUsage = result.memory;
 
     cppContext.delete();
     for (let i = 0; i < cppConcepts.size(); i++) {
@@ -58,6 +62,7 @@ export async function conceptsToLattice(concepts: FormalConcepts, context: Forma
             attributesLabeling,
         },
         computationTime,
+        memoryUsage,
     };
 }
 
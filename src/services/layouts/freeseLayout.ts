@@ -1,28 +1,40 @@
-import Module from "../../cpp";
+import Module, { LayoutSession } from "../../cpp";
 import { cppFloatArrayToPoints } from "../../utils/cpp";
 import { Point } from "../../types/Point";
+import { MemoryUsage } from "../../types/MemoryUsage";
+import { ConvergenceCriteria } from "../../types/diagram/ConvergenceCriteria";
+import { LayoutWarmStart } from "../../types/diagram/LayoutWarmStart";
+import { DEFAULT_CONVERGENCE_CRITERIA } from "../../constants/layouts";
 
 export async function computeFreeseLayout(
-    conceptsCount: number,
-    supremum: number,
-    infimum: number,
-    subconceptsMappingArrayBuffer: Int32Array,
+    session: LayoutSession,
     onProgress: (progress: number) => void,
+    convergenceCriteria: ConvergenceCriteria = DEFAULT_CONVERGENCE_CRITERIA,
+    warmStart?: LayoutWarmStart,
 ): Promise<{
     layout: Array<Point>,
     computationTime: number,
+    memoryUsage: MemoryUsage,
+    iterationsCount: number,
+    stopReason: string,
 }> {
     const module = await Module();
-    const result = new module.FloatArrayTimedResult();
+    const result = new module.FloatArrayIterativeTimedResult();
 
-    module.computeFreeseLayout(result, supremum, infimum, conceptsCount, subconceptsMappingArrayBuffer, onProgress);
-    const layout = cppFloatArrayToPoints(result.value, conceptsCount, true);
+    session.computeFreeseLayout(result, convergenceCriteria, warmStart?.previousLayout, warmStart?.newIndexes, onProgress);
+    const layout = cppFloatArrayToPoints(result.value, session.conceptsCount, true);
     const computationTime = result.time;
+    const memoryUsage = result.memory;
+    const iterationsCount = result.iterationsCount;
+    const stopReason = result.stopReason.toString();
 
     result.delete();
 
     return {
         layout,
         computationTime,
+        memoryUsage,
+        iterationsCount,
+        stopReason,
     };
 }
\ No newline at end of file
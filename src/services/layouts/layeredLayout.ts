@@ -1,29 +1,36 @@
-import Module from "../../cpp";
+import Module, { LayoutSession } from "../../cpp";
 import { cppFloatArrayToPoints } from "../../utils/cpp";
 import { Point } from "../../types/Point";
+import { MemoryUsage } from "../../types/MemoryUsage";
 import { LayeredLayoutPlacement } from "../../types/diagram/LayeredLayoutPlacement";
+import { LayeredLayoutLayering } from "../../types/diagram/LayeredLayoutLayering";
+import { DEFAULT_LAYERED_CROSSINGS_TIME_BUDGET, DEFAULT_LAYERED_RESTARTS_COUNT } from "../../constants/layouts";
 
 export async function computeLayeredLayout(
-    conceptsCount: number,
-    supremum: number,
-    subconceptsMappingArrayBuffer: Int32Array,
+    session: LayoutSession,
     placement: LayeredLayoutPlacement,
+    layering: LayeredLayoutLayering,
     onProgress: (progress: number) => void,
+    crossingsTimeBudget: number = DEFAULT_LAYERED_CROSSINGS_TIME_BUDGET,
+    restartsCount: number = DEFAULT_LAYERED_RESTARTS_COUNT,
 ): Promise<{
     layout: Array<Point>,
     computationTime: number,
+    memoryUsage: MemoryUsage,
 }> {
     const module = await Module();
     const result = new module.FloatArrayTimedResult();
 
-    module.computeLayeredLayout(result, supremum, conceptsCount, subconceptsMappingArrayBuffer, placement, onProgress);
-    const layout = cppFloatArrayToPoints(result.value, conceptsCount, true);
+    session.computeLayeredLayout(result, placement, layering, crossingsTimeBudget, restartsCount, onProgress);
+    const layout = cppFloatArrayToPoints(result.value, session.conceptsCount, true);
     const computationTime = result.time;
+    const memoryUsage = result.memory;
 
     result.delete();
 
     return {
         layout,
         computationTime,
+        memoryUsage,
     };
 }
\ No newline at end of file
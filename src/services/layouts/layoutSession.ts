@@ -0,0 +1,16 @@
+import Module, { LayoutSession } from "../../cpp";
+
+/**
+ * Creates a session that converts the cover relation only once and can compute multiple layouts of the lattice.
+ * The session has to be deleted when it is not needed anymore.
+ */
+export async function createLayoutSession(
+    conceptsCount: number,
+    supremum: number,
+    infimum: number,
+    subconceptsMappingArrayBuffer: Int32Array,
+): Promise<LayoutSession> {
+    const module = await Module();
+
+    return new module.LayoutSession(supremum, infimum, conceptsCount, subconceptsMappingArrayBuffer);
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+import Module, { LayoutSession } from "../../cpp";
+import { cppFloatArrayToPoints } from "../../utils/cpp";
+import { Point } from "../../types/Point";
+import { MemoryUsage } from "../../types/MemoryUsage";
+import { ConvergenceCriteria } from "../../types/diagram/ConvergenceCriteria";
+import { MultilevelLayoutEngine } from "../../types/diagram/MultilevelLayoutEngine";
+import { DEFAULT_CONVERGENCE_CRITERIA } from "../../constants/layouts";
+
+export async function computeMultilevelLayout(
+    session: LayoutSession,
+    engine: MultilevelLayoutEngine,
+    seed: number,
+    targetDimension: 2 | 3,
+    parallelize: boolean,
+    onProgress: (progress: number) => void,
+    convergenceCriteria: ConvergenceCriteria = DEFAULT_CONVERGENCE_CRITERIA,
+): Promise<{
+    layout: Array<Point>,
+    computationTime: number,
+    memoryUsage: MemoryUsage,
+    iterationsCount: number,
+    stopReason: string,
+}> {
+    const module = await Module();
+    const result = new module.FloatArrayIterativeTimedResult();
+
+    session.computeMultilevelLayout(result, engine, seed, targetDimension, parallelize, convergenceCriteria, onProgress);
+    const layout = cppFloatArrayToPoints(result.value, session.conceptsCount, true);
+    const computationTime = result.time;
+    const memoryUsage = result.memory;
+    const iterationsCount = result.iterationsCount;
+    const stopReason = result.stopReason.toString();
+
+    result.delete();
+
+    return {
+        layout,
+        computationTime,
+        memoryUsage,
+        iterationsCount,
+        stopReason,
+    };
+}
\ No newline at end of file
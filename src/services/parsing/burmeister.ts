@@ -1,10 +1,11 @@
-import { FORMAL_CONTEXT_CELL_SIZE, FormalContext } from "../../types/FormalContext";
+import { FormalContext } from "../../types/FormalContext";
 import { isNullOrWhiteSpace, readLine } from "../../utils/string";
 import { INVALID_FILE_MESSAGE } from "./constants";
+import parseContextNatively from "./native";
 
 const INVALID_FILE_LINE_MESSAGE = `${INVALID_FILE_MESSAGE} Line:`;
 
-export default function parseBurmeister(content: string): FormalContext {
+export default async function parseBurmeister(content: string): Promise<FormalContext> {
     content = content.trim();
     const bLine = readLine(content, 0);
     if (bLine.line.trim().toLowerCase() !== "b")
@@ -34,85 +35,10 @@ export default function parseBurmeister(content: string): FormalContext {
     if (!isFinite(objectsCount) || !isFinite(attributesCount))
         throw new Error(`${INVALID_FILE_LINE_MESSAGE} 2 or 3`);
 
-    return parseContext(
-        objectsCount,
-        attributesCount,
-        content,
-        emptyLine.nextStart,
-        isNullOrWhiteSpace(nameLine.line) ? undefined : nameLine.line.trim());
-}
+    const name = isNullOrWhiteSpace(nameLine.line) ? undefined : nameLine.line.trim();
 
-function parseContext(objectsCount: number, attributesCount: number, content: string, start: number, name?: string): FormalContext {
-    const cellsPerObjectCount = Math.ceil(attributesCount / FORMAL_CONTEXT_CELL_SIZE);
-    const context = new Array<number>(objectsCount * cellsPerObjectCount);
-    const objects = new Array<string>(objectsCount);
-    const attributes = new Array<string>(attributesCount);
+    // The header is validated here, the names and the cross table are parsed and validated by the native parser
+    const context = (await parseContextNatively(content, "burmeister"))!;
 
-    for (let i = 0; i < objectsCount; i++) {
-        const line = readLine(content, start);
-
-        if (line.nextStart === -1)
-            throw new Error(`${INVALID_FILE_MESSAGE} Objects could not be parsed.`);
-
-        objects[i] = line.line.trim();
-        start = line.nextStart;
-    }
-
-    for (let i = 0; i < attributesCount; i++) {
-        const line = readLine(content, start);
-
-        if (line.nextStart === -1)
-            throw new Error(`${INVALID_FILE_MESSAGE} Attributes could not be parsed.`);
-
-        attributes[i] = line.line.trim();
-        start = line.nextStart;
-    }
-
-    for (let i = 0; i < objectsCount; i++) {
-        if (start === -1)
-            throw new Error(`${INVALID_FILE_MESSAGE} Context could not be parsed.`);
-
-        const line = readLine(content, start);
-        const lineContent = line.line.trim();
-        let contextOffset = 0;
-        let offset = 0n;
-        let value = 0n;
-
-        if (lineContent.length < attributesCount)
-            throw new Error(`${INVALID_FILE_MESSAGE} Context could not be parsed.`);
-
-        for (let j = 0; j < attributesCount; j++) {
-            const char = lineContent[j].toLowerCase();
-
-            if (char === ".") {
-                offset++;
-            }
-            else if (char === "x") {
-                value = value | (1n << offset);
-                offset++;
-            }
-            else {
-                throw new Error(`${INVALID_FILE_MESSAGE} Context could not be parsed.`);
-            }
-
-            if (offset === BigInt(FORMAL_CONTEXT_CELL_SIZE)) {
-                context[i * cellsPerObjectCount + contextOffset] = Number(value);
-                contextOffset++;
-                value = 0n;
-                offset = 0n;
-            }
-        }
-
-        context[i * cellsPerObjectCount + contextOffset] = Number(value);
-        start = line.nextStart;
-    }
-
-    return {
-        name,
-        context,
-        objects,
-        attributes,
-        cellsPerObject: cellsPerObjectCount,
-        cellSize: FORMAL_CONTEXT_CELL_SIZE,
-    };
+    return { ...context, name };
 }
\ No newline at end of file
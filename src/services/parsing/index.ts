@@ -1,38 +1,57 @@
 import { ConceptLattice } from "../../types/ConceptLattice";
+import { ConceptLatticeLayout } from "../../types/ConceptLatticeLayout";
 import { CsvSeparator } from "../../types/CsvSeparator";
 import { FormalConcepts } from "../../types/FormalConcepts";
 import { FormalContext } from "../../types/FormalContext";
 import { ImportFormat } from "../../types/ImportFormat";
 import parseBurmeister from "./burmeister";
-import parseCsv from "./csv";
+import { INVALID_FILE_MESSAGE } from "./constants";
 import parseJson from "./json";
+import parseContextNatively from "./native";
+import parseProject from "./project";
 import parseXml from "./xml";
 
-export async function parseFileContent(content: string, format: ImportFormat, separator?: CsvSeparator): Promise<{
+export async function parseFileContent(content: string | ArrayBuffer, format: ImportFormat, separator?: CsvSeparator): Promise<{
     context: FormalContext,
     concepts?: FormalConcepts,
     lattice?: ConceptLattice,
+    layouts?: Array<{ key: string, layout: ConceptLatticeLayout }>,
 }> {
+    // Project files are the only binary files, they are read as an ArrayBuffer
+    if (format === "project") {
+        return parseProject(content as ArrayBuffer);
+    }
+    if (typeof content !== "string") {
+        throw new Error(INVALID_FILE_MESSAGE);
+    }
+
     let context: FormalContext;
     let concepts: FormalConcepts | undefined = undefined;
     let lattice: ConceptLattice | undefined = undefined;
 
     switch (format) {
         case "burmeister":
-            context = parseBurmeister(content);
+            context = await parseBurmeister(content);
             break;
         case "json":
-            ({ context, concepts, lattice } = parseJson(content));
-            break;
-        case "xml":
-            ({ context, concepts, lattice } = parseXml(content));
+        case "xml": {
+            const nativeContext = await parseContextNatively(content, format);
+
+            if (nativeContext) {
+                context = nativeContext;
+            }
+            else {
+                // Files with concepts are parsed together with the concepts and the lattice
+                ({ context, concepts, lattice } = format === "json" ? parseJson(content) : parseXml(content));
+            }
             break;
+        }
         case "csv":
             if (!separator) {
                 throw new Error("Separator was not defined.");
             }
 
-            context = parseCsv(content, separator);
+            context = (await parseContextNatively(content, format, separator))!;
             break;
     }
 
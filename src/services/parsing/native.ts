@@ -0,0 +1,61 @@
+import Module, { ParsedContext } from "../../cpp";
+import { FORMAL_CONTEXT_CELL_SIZE, FormalContext } from "../../types/FormalContext";
+import { CsvSeparator } from "../../types/CsvSeparator";
+import { cppStringArrayToJs } from "../../utils/cpp";
+import { INVALID_FILE_MESSAGE } from "./constants";
+
+/**
+ * Parses a context file by the native streaming parser, the context matrix is packed directly in wasm.
+ * @returns undefined if the file stores concepts instead of a relation, those are parsed in JavaScript.
+ */
+export default async function parseContextNatively(content: string, format: "burmeister" | "csv" | "json" | "xml", separator?: CsvSeparator): Promise<FormalContext | undefined> {
+    const module = await Module();
+    const parsedContext = new module.ParsedContext();
+
+    try {
+        let error: string;
+
+        switch (format) {
+            case "burmeister":
+                // Rows of large cross tables are parsed on multiple threads when the module is built with them
+                error = module.parseBurmeisterContext(parsedContext, content, true);
+                break;
+            case "csv":
+                error = module.parseCsv(parsedContext, content, separator ?? ",");
+                break;
+            case "json":
+                error = module.parseJson(parsedContext, content);
+                break;
+            case "xml":
+                error = module.parseXml(parsedContext, content);
+                break;
+        }
+
+        if (error) {
+            throw new Error(`${INVALID_FILE_MESSAGE} ${error}`);
+        }
+
+        return parsedContext.hasConcepts ?
+            undefined :
+            toFormalContext(module.getParsedContextMatrixView(parsedContext), parsedContext);
+    }
+    finally {
+        parsedContext.delete();
+    }
+}
+
+function toFormalContext(contextView: Uint32Array, parsedContext: ParsedContext): FormalContext {
+    // The view has to be copied before anything else is allocated in wasm
+    const context = Array.from(contextView);
+    const objects = [...cppStringArrayToJs(parsedContext.objects, true)];
+    const attributes = [...cppStringArrayToJs(parsedContext.attributes, true)];
+
+    return {
+        name: parsedContext.hasName ? parsedContext.name as string : undefined,
+        context,
+        objects,
+        attributes,
+        cellsPerObject: Math.ceil(attributes.length / FORMAL_CONTEXT_CELL_SIZE),
+        cellSize: FORMAL_CONTEXT_CELL_SIZE,
+    };
+}
\ No newline at end of file
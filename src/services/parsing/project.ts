@@ -0,0 +1,26 @@
+import { ConceptLattice } from "../../types/ConceptLattice";
+import { ConceptLatticeLayout } from "../../types/ConceptLatticeLayout";
+import { FormalConcepts } from "../../types/FormalConcepts";
+import { FormalContext } from "../../types/FormalContext";
+import { openProjectFile } from "../projectFile";
+
+export default function parseProject(buffer: ArrayBuffer): {
+    context: FormalContext,
+    concepts?: FormalConcepts,
+    lattice?: ConceptLattice,
+    layouts: Array<{ key: string, layout: ConceptLatticeLayout }>,
+} {
+    const project = openProjectFile(buffer);
+    const context = project.readContext();
+    const concepts = project.hasConcepts() ? project.readConcepts() : undefined;
+    // The cover relation is useless without the concepts, they are computed again in that case
+    const lattice = concepts && project.hasLattice() ? project.readLattice(concepts) : undefined;
+    // Layouts of other lattices than the stored one cannot be used
+    const layouts = !lattice ?
+        [] :
+        project.readLayoutKeys()
+            .map((key) => ({ key, layout: project.readLayout(key)! }))
+            .filter(({ layout }) => layout.length === concepts!.length);
+
+    return { context, concepts, lattice, layouts };
+}
\ No newline at end of file
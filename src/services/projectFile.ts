@@ -0,0 +1,525 @@
+import { ConceptLattice } from "../types/ConceptLattice";
+import { ConceptLatticeLayout } from "../types/ConceptLatticeLayout";
+import { createConceptPoint } from "../types/diagram/ConceptPoint";
+import { LayoutComputationOptions } from "../types/diagram/LayoutComputationOptions";
+import { FormalConcepts } from "../types/FormalConcepts";
+import { FormalContext } from "../types/FormalContext";
+import { getAttributesLabeling, getObjectsLabeling, reverseMapping } from "./lattice";
+
+// Reader and writer of project files (.konlatt), the format is described in src/cpp/projectFile.h
+
+export const PROJECT_FILE_VERSION = 1;
+export const PROJECT_FILE_EXTENSION = ".konlatt";
+
+const PROJECT_FILE_MAGIC = "KNLT";
+const HEADER_SIZE = 16;
+const SECTION_ENTRY_SIZE = 24;
+const SECTION_ALIGNMENT = 8;
+const CORRUPTED_FILE_MESSAGE = "The project file is corrupted.";
+
+enum ProjectSectionType {
+    Names = 1,
+    Context = 2,
+    Concepts = 3,
+    Cover = 4,
+    Layout = 5,
+}
+
+type ProjectSection = {
+    type: number,
+    offset: number,
+    size: number,
+}
+
+export type ProjectFile = {
+    readonly version: number,
+    hasContext: () => boolean,
+    hasConcepts: () => boolean,
+    hasLattice: () => boolean,
+    readContext: () => FormalContext,
+    readConcepts: () => FormalConcepts,
+    readLattice: (concepts: FormalConcepts) => ConceptLattice,
+    readLayoutKeys: () => Array<string>,
+    readLayout: (key: string) => ConceptLatticeLayout | undefined,
+}
+
+/**
+ * Opens a project file without decoding its sections.
+ * Each section is decoded only when it is read, numeric arrays are viewed directly in the buffer.
+ */
+export function openProjectFile(buffer: ArrayBuffer): ProjectFile {
+    const view = new DataView(buffer);
+
+    if (buffer.byteLength < HEADER_SIZE || new TextDecoder().decode(new Uint8Array(buffer, 0, 4)) !== PROJECT_FILE_MAGIC) {
+        throw new Error("The file is not a project file.");
+    }
+
+    const version = view.getUint32(4, true);
+
+    if (version > PROJECT_FILE_VERSION) {
+        throw new Error("The project file was created by a newer version.");
+    }
+
+    const sectionsCount = view.getUint32(8, true);
+    const sections = new Array<ProjectSection>();
+
+    if (HEADER_SIZE + (sectionsCount * SECTION_ENTRY_SIZE) > buffer.byteLength) {
+        throw new Error(CORRUPTED_FILE_MESSAGE);
+    }
+
+    for (let i = 0; i < sectionsCount; i++) {
+        const entryOffset = HEADER_SIZE + (i * SECTION_ENTRY_SIZE);
+        const section = {
+            type: view.getUint32(entryOffset, true),
+            offset: readUInt64(view, entryOffset + 8),
+            size: readUInt64(view, entryOffset + 16),
+        };
+
+        if (section.offset % 4 !== 0 || section.offset + section.size > buffer.byteLength) {
+            throw new Error(CORRUPTED_FILE_MESSAGE);
+        }
+
+        sections.push(section);
+    }
+
+    const findSection = (type: ProjectSectionType) => sections.find((section) => section.type === type);
+    const getSection = (type: ProjectSectionType) => {
+        const section = findSection(type);
+
+        if (!section) {
+            throw new Error("The project file does not contain the requested section.");
+        }
+
+        return new SectionReader(buffer, section);
+    };
+
+    return {
+        version,
+        hasContext: () => !!findSection(ProjectSectionType.Names) && !!findSection(ProjectSectionType.Context),
+        hasConcepts: () => !!findSection(ProjectSectionType.Concepts),
+        hasLattice: () => !!findSection(ProjectSectionType.Cover),
+        readContext: () => readContext(getSection(ProjectSectionType.Names), getSection(ProjectSectionType.Context)),
+        readConcepts: () => readConcepts(getSection(ProjectSectionType.Concepts)),
+        readLattice: (concepts: FormalConcepts) => readLattice(getSection(ProjectSectionType.Cover), concepts),
+        readLayoutKeys: () => sections
+            .filter((section) => section.type === ProjectSectionType.Layout)
+            .map((section) => readLayoutKey(new SectionReader(buffer, section))),
+        readLayout: (key: string) => {
+            for (const section of sections) {
+                if (section.type !== ProjectSectionType.Layout) {
+                    continue;
+                }
+
+                const reader = new SectionReader(buffer, section);
+                const conceptsCount = reader.readUInt32();
+
+                if (readLayoutKey(reader) === key) {
+                    return readLayout(reader, conceptsCount);
+                }
+            }
+
+            return undefined;
+        },
+    };
+}
+
+/**
+ * Identifies the options a layout was computed with, the keys have the same format as the keys written by the command-line tool.
+ */
+export function getProjectLayoutKey(options: LayoutComputationOptions) {
+    switch (options.layoutMethod) {
+        case "layered":
+            return `${options.layoutMethod};${options.placementLayered};${options.layeringLayered}`;
+        case "freese":
+            return options.layoutMethod;
+        case "redraw":
+            return `${options.layoutMethod};${options.seedReDraw};${options.targetDimensionReDraw}`;
+        case "multilevel":
+            return `${options.layoutMethod};${options.engineMultilevel};${options.seedReDraw};${options.targetDimensionReDraw}`;
+    }
+}
+
+/**
+ * Writes a project file with the context and optionally with the concepts, lattice and layouts.
+ */
+export function writeProjectFile(
+    context: FormalContext,
+    concepts?: FormalConcepts,
+    lattice?: ConceptLattice,
+    layouts?: ReadonlyArray<{ key: string, layout: ConceptLatticeLayout }>,
+): ArrayBuffer {
+    const sections: Array<[ProjectSectionType, SectionWriter]> = [];
+
+    sections.push([ProjectSectionType.Names, writeNames(context)]);
+    sections.push([ProjectSectionType.Context, writeContext(context)]);
+
+    if (concepts) {
+        sections.push([ProjectSectionType.Concepts, writeConcepts(concepts)]);
+    }
+
+    if (lattice) {
+        sections.push([ProjectSectionType.Cover, writeCover(lattice)]);
+    }
+
+    for (const { key, layout } of layouts ?? []) {
+        sections.push([ProjectSectionType.Layout, writeLayout(key, layout)]);
+    }
+
+    const offsets = new Array<number>();
+    let offset = HEADER_SIZE + (sections.length * SECTION_ENTRY_SIZE);
+
+    for (const [, section] of sections) {
+        offset = align(offset, SECTION_ALIGNMENT);
+        offsets.push(offset);
+        offset += section.size;
+    }
+
+    const buffer = new ArrayBuffer(offset);
+    const view = new DataView(buffer);
+    const bytes = new Uint8Array(buffer);
+
+    bytes.set(new TextEncoder().encode(PROJECT_FILE_MAGIC), 0);
+    view.setUint32(4, PROJECT_FILE_VERSION, true);
+    view.setUint32(8, sections.length, true);
+
+    sections.forEach(([type, section], i) => {
+        const entryOffset = HEADER_SIZE + (i * SECTION_ENTRY_SIZE);
+
+        view.setUint32(entryOffset, type, true);
+        writeUInt64(view, entryOffset + 8, offsets[i]);
+        writeUInt64(view, entryOffset + 16, section.size);
+        section.copyTo(bytes, offsets[i]);
+    });
+
+    return buffer;
+}
+
+function readContext(namesReader: SectionReader, contextReader: SectionReader): FormalContext {
+    const objectsCount = namesReader.readUInt32();
+    const attributesCount = namesReader.readUInt32();
+    const offsets = namesReader.readUInt32Array(objectsCount + attributesCount + 2);
+    const strings = namesReader.readBytes(offsets[offsets.length - 1]);
+    const decoder = new TextDecoder();
+    const readString = (index: number) => {
+        if (offsets[index] > offsets[index + 1]) {
+            throw new Error(CORRUPTED_FILE_MESSAGE);
+        }
+        return decoder.decode(strings.subarray(offsets[index], offsets[index + 1]));
+    };
+
+    const name = readString(0);
+    const objects = new Array<string>(objectsCount);
+    const attributes = new Array<string>(attributesCount);
+
+    for (let i = 0; i < objectsCount; i++) {
+        objects[i] = readString(1 + i);
+    }
+    for (let i = 0; i < attributesCount; i++) {
+        attributes[i] = readString(1 + objectsCount + i);
+    }
+
+    if (contextReader.readUInt32() !== objectsCount || contextReader.readUInt32() !== attributesCount) {
+        throw new Error(CORRUPTED_FILE_MESSAGE);
+    }
+
+    const cellSize = contextReader.readUInt32();
+    const cellsPerObject = contextReader.readUInt32();
+    const context = Array.from(contextReader.readUInt32Array(objectsCount * cellsPerObject));
+
+    return {
+        name: name.length > 0 ? name : undefined,
+        context,
+        objects,
+        attributes,
+        cellsPerObject,
+        cellSize,
+    };
+}
+
+function readConcepts(reader: SectionReader): FormalConcepts {
+    const conceptsCount = reader.readUInt32();
+    const extents = readLists(reader, conceptsCount);
+    const intents = readLists(reader, conceptsCount);
+
+    return extents.map((objects, index) => ({
+        index,
+        objects,
+        attributes: intents[index],
+    }));
+}
+
+function readLattice(reader: SectionReader, concepts: FormalConcepts): ConceptLattice {
+    const conceptsCount = reader.readUInt32();
+    const subconceptsMapping = readLists(reader, conceptsCount).map((subconcepts) => new Set<number>(subconcepts));
+    const superconceptsMapping = reverseMapping(subconceptsMapping);
+
+    return {
+        subconceptsMapping,
+        superconceptsMapping,
+        objectsLabeling: getObjectsLabeling(concepts, superconceptsMapping),
+        attributesLabeling: getAttributesLabeling(concepts, subconceptsMapping),
+    };
+}
+
+function readLayoutKey(reader: SectionReader) {
+    reader.position = 4;
+    const keyLength = reader.readUInt32();
+    const key = new TextDecoder().decode(reader.readBytes(keyLength));
+    reader.position = align(reader.position, 4);
+
+    return key;
+}
+
+function readLayout(reader: SectionReader, conceptsCount: number): ConceptLatticeLayout {
+    const coordinates = reader.readFloat32Array(conceptsCount * 3);
+    const layout: ConceptLatticeLayout = new Array(conceptsCount);
+
+    for (let i = 0; i < conceptsCount; i++) {
+        layout[i] = createConceptPoint(coordinates[i * 3], coordinates[(i * 3) + 1], coordinates[(i * 3) + 2], i);
+    }
+
+    return layout;
+}
+
+function readLists(reader: SectionReader, listsCount: number): Array<Array<number>> {
+    const offsets = reader.readUInt32Array(listsCount + 1);
+    const values = reader.readUInt32Array(offsets[listsCount]);
+    const lists = new Array<Array<number>>(listsCount);
+
+    for (let i = 0; i < listsCount; i++) {
+        if (offsets[i] > offsets[i + 1]) {
+            throw new Error(CORRUPTED_FILE_MESSAGE);
+        }
+
+        // A plain loop is much faster than Array.from() on typed arrays
+        const list = new Array<number>(offsets[i + 1] - offsets[i]);
+
+        for (let j = 0; j < list.length; j++) {
+            list[j] = values[offsets[i] + j];
+        }
+
+        lists[i] = list;
+    }
+
+    return lists;
+}
+
+function writeNames(context: FormalContext) {
+    const encoder = new TextEncoder();
+    const strings = [context.name ?? "", ...context.objects, ...context.attributes].map((value) => encoder.encode(value));
+    const writer = new SectionWriter();
+    let offset = 0;
+
+    writer.writeUInt32(context.objects.length);
+    writer.writeUInt32(context.attributes.length);
+    writer.writeUInt32(offset);
+
+    for (const value of strings) {
+        offset += value.length;
+        writer.writeUInt32(offset);
+    }
+
+    for (const value of strings) {
+        writer.writeBytes(value);
+    }
+
+    return writer;
+}
+
+function writeContext(context: FormalContext) {
+    const writer = new SectionWriter();
+
+    writer.writeUInt32(context.objects.length);
+    writer.writeUInt32(context.attributes.length);
+    writer.writeUInt32(context.cellSize);
+    writer.writeUInt32(context.cellsPerObject);
+    writer.writeUInt32Array(context.context);
+
+    return writer;
+}
+
+function writeConcepts(concepts: FormalConcepts) {
+    const writer = new SectionWriter();
+
+    writer.writeUInt32(concepts.length);
+    writeLists(writer, concepts.map((concept) => concept.objects));
+    writeLists(writer, concepts.map((concept) => concept.attributes));
+
+    return writer;
+}
+
+function writeCover(lattice: ConceptLattice) {
+    const writer = new SectionWriter();
+
+    writer.writeUInt32(lattice.subconceptsMapping.length);
+    writeLists(writer, lattice.subconceptsMapping.map((subconcepts) => [...subconcepts].sort((a, b) => a - b)));
+
+    return writer;
+}
+
+function writeLayout(key: string, layout: ConceptLatticeLayout) {
+    const writer = new SectionWriter();
+    const keyBytes = new TextEncoder().encode(key);
+    const coordinates = new Float32Array(layout.length * 3);
+
+    for (const point of layout) {
+        coordinates[point.conceptIndex * 3] = point.x;
+        coordinates[(point.conceptIndex * 3) + 1] = point.y;
+        coordinates[(point.conceptIndex * 3) + 2] = point.z;
+    }
+
+    writer.writeUInt32(layout.length);
+    writer.writeUInt32(keyBytes.length);
+    writer.writeBytes(keyBytes);
+    writer.writePadding(4);
+    writer.writeFloat32Array(coordinates);
+
+    return writer;
+}
+
+function writeLists(writer: SectionWriter, lists: ReadonlyArray<ReadonlyArray<number>>) {
+    let offset = 0;
+    writer.writeUInt32(offset);
+
+    for (const list of lists) {
+        offset += list.length;
+        writer.writeUInt32(offset);
+    }
+
+    const values = new Uint32Array(offset);
+    offset = 0;
+
+    for (const list of lists) {
+        values.set(list, offset);
+        offset += list.length;
+    }
+
+    writer.writeUInt32Array(values);
+}
+
+function readUInt64(view: DataView, offset: number) {
+    return view.getUint32(offset, true) + (view.getUint32(offset + 4, true) * 2 ** 32);
+}
+
+function writeUInt64(view: DataView, offset: number, value: number) {
+    view.setUint32(offset, value % 2 ** 32, true);
+    view.setUint32(offset + 4, Math.floor(value / 2 ** 32), true);
+}
+
+function align(offset: number, alignment: number) {
+    return Math.ceil(offset / alignment) * alignment;
+}
+
+/**
+ * Sequential reader of a section with bounds checks.
+ * Arrays are viewed directly in the buffer, the sections are aligned, so that typed arrays can be created on them.
+ */
+class SectionReader {
+    position: number = 0;
+    private readonly view: DataView;
+
+    constructor(private readonly buffer: ArrayBuffer, private readonly section: ProjectSection) {
+        this.view = new DataView(buffer, section.offset, section.size);
+    }
+
+    readUInt32() {
+        this.checkBounds(4);
+        const value = this.view.getUint32(this.position, true);
+        this.position += 4;
+
+        return value;
+    }
+
+    readBytes(count: number) {
+        this.checkBounds(count);
+        const value = new Uint8Array(this.buffer, this.section.offset + this.position, count);
+        this.position += count;
+
+        return value;
+    }
+
+    // The values are stored in the little-endian order of all the platforms the app runs on
+    readUInt32Array(count: number) {
+        this.checkBounds(count * 4);
+        const value = new Uint32Array(this.buffer, this.section.offset + this.position, count);
+        this.position += count * 4;
+
+        return value;
+    }
+
+    readFloat32Array(count: number) {
+        this.checkBounds(count * 4);
+        const value = new Float32Array(this.buffer, this.section.offset + this.position, count);
+        this.position += count * 4;
+
+        return value;
+    }
+
+    private checkBounds(count: number) {
+        if (this.position + count > this.section.size) {
+            throw new Error(CORRUPTED_FILE_MESSAGE);
+        }
+    }
+}
+
+/**
+ * Collects chunks of a section, they are copied to the output buffer at once.
+ */
+class SectionWriter {
+    private chunksSize: number = 0;
+    private readonly chunks = new Array<Uint8Array>();
+    private numbers = new Array<number>();
+
+    get size() {
+        return this.chunksSize + (this.numbers.length * 4);
+    }
+
+    writeUInt32(value: number) {
+        this.numbers.push(value);
+    }
+
+    writeUInt32Array(values: ArrayLike<number>) {
+        this.flushNumbers();
+        const array = values instanceof Uint32Array ? values : Uint32Array.from(values);
+        this.addChunk(new Uint8Array(array.buffer, array.byteOffset, array.byteLength));
+    }
+
+    writeFloat32Array(values: Float32Array) {
+        this.flushNumbers();
+        this.addChunk(new Uint8Array(values.buffer, values.byteOffset, values.byteLength));
+    }
+
+    writeBytes(bytes: Uint8Array) {
+        this.flushNumbers();
+        this.addChunk(bytes);
+    }
+
+    writePadding(alignment: number) {
+        this.flushNumbers();
+        this.addChunk(new Uint8Array(align(this.size, alignment) - this.size));
+    }
+
+    copyTo(bytes: Uint8Array, offset: number) {
+        this.flushNumbers();
+
+        for (const chunk of this.chunks) {
+            bytes.set(chunk, offset);
+            offset += chunk.length;
+        }
+    }
+
+    private flushNumbers() {
+        if (this.numbers.length === 0) {
+            return;
+        }
+
+        const values = Uint32Array.from(this.numbers);
+        this.numbers = [];
+        this.addChunk(new Uint8Array(values.buffer));
+    }
+
+    private addChunk(chunk: Uint8Array) {
+        this.chunks.push(chunk);
+        this.chunksSize += chunk.length;
+    }
+}
\ No newline at end of file
@@ -21,7 +21,7 @@ import useExportExplorerConceptsStore from "../stores/export/concepts/useExportE
 import { DiagramLayoutState } from "../types/diagram/DiagramLayoutState";
 
 export async function triggerInitialization(
-    fileContent: string,
+    fileContent: string | ArrayBuffer,
     format: ImportFormat,
     csvSeparator: CsvSeparator | null,
     name: string,
@@ -110,7 +110,7 @@ export function triggerCancellation(jobId: number) {
 
 function enqueFileParsing(
     workerQueue: MainWorkerQueue,
-    fileContent: string,
+    fileContent: string | ArrayBuffer,
     format: ImportFormat,
     csvSeparator: CsvSeparator | null,
     onSuccess: (response: ContextParsingResponse) => void,
@@ -208,6 +208,8 @@ function enqueueLayoutComputation(workerQueue: MainWorkerQueue, state: DiagramLa
             targetDimensionReDraw: state.targetDimensionReDraw,
             seedReDraw: state.seedReDraw,
             placementLayered: state.placementLayered,
+            layeringLayered: state.layeringLayered,
+            engineMultilevel: state.engineMultilevel,
         },
     };
 
@@ -2,8 +2,10 @@ import { MAX_SEED_LENGTH_REDRAW } from "../../constants/canvas-drawing";
 import { calculateConeConceptIndexes } from "../../services/lattice";
 import { CameraType } from "../../types/diagram/CameraType";
 import { DiagramLayoutState } from "../../types/diagram/DiagramLayoutState";
+import { LayeredLayoutLayering } from "../../types/diagram/LayeredLayoutLayering";
 import { LayeredLayoutPlacement } from "../../types/diagram/LayeredLayoutPlacement";
 import { LayoutMethod } from "../../types/diagram/LayoutMethod";
+import { MultilevelLayoutEngine } from "../../types/diagram/MultilevelLayoutEngine";
 import { w } from "../../utils/stores";
 import { generateRandomSeed } from "../../utils/string";
 import useDataStructuresStore from "../useDataStructuresStore";
@@ -58,9 +60,11 @@ type DiagramOptionsSliceActions = {
     setUpperConeOnlyConceptIndex: (upperConeOnlyConceptIndex: number | null, withOtherReset?: boolean) => void,
     setLowerConeOnlyConceptIndex: (lowerConeOnlyConceptIndex: number | null, withOtherReset?: boolean) => void,
     setPlacementLayered: (placement: LayeredLayoutPlacement) => void,
+    setLayeringLayered: (layering: LayeredLayoutLayering) => void,
     setParallelizeReDraw: React.Dispatch<React.SetStateAction<boolean>>,
     setTargetDimensionReDraw: React.Dispatch<React.SetStateAction<2 | 3>>,
     setSeedReDraw: (seedReDraw: string) => void,
+    setEngineMultilevel: (engine: MultilevelLayoutEngine) => void,
 }
 
 export type DiagramOptionsSlice = DiagramOptionsSliceState & DiagramOptionsSliceActions
@@ -89,9 +93,11 @@ export function initialState(): DiagramOptionsSliceState {
         lowerConeOnlyConceptIndex: null,
         sublatticeConceptIndexes: null,
         placementLayered: "simple",
+        layeringLayered: "longestPath",
         parallelizeReDraw: true,
         targetDimensionReDraw: 2,
         seedReDraw: generateRandomSeed(MAX_SEED_LENGTH_REDRAW),
+        engineMultilevel: "freese",
     };
 }
 
@@ -166,6 +172,7 @@ export default function createDiagramOptionsSlice(set: (partial: DiagramStore |
             },
             old, withLayout, withDiagramLabeling)),
         setPlacementLayered: (placementLayered) => set((old) => withLayout({ placementLayered }, old)),
+        setLayeringLayered: (layeringLayered) => set((old) => withLayout({ layeringLayered }, old)),
         setParallelizeReDraw: (parallelizeReDraw) => set((old) => withLayout(
             {
                 parallelizeReDraw: typeof parallelizeReDraw === "function" ?
@@ -181,6 +188,7 @@ export default function createDiagramOptionsSlice(set: (partial: DiagramStore |
             },
             old)),
         setSeedReDraw: (seedReDraw) => set((old) => withLayout({ seedReDraw }, old)),
+        setEngineMultilevel: (engineMultilevel) => set((old) => withLayout({ engineMultilevel }, old)),
         setHorizontalScale: (horizontalScale) => set((old) => w({ horizontalScale }, old, withConceptsToMoveBox, withDefaultLayoutBox)),
         setVerticalScale: (verticalScale) => set((old) => w({ verticalScale }, old, withConceptsToMoveBox, withDefaultLayoutBox)),
         setRotationDegrees: (rotationDegrees) => set((old) => w({ rotationDegrees }, old, withConceptsToMoveBox, withDefaultLayoutBox)),
@@ -36,7 +36,7 @@ export function createDiagramLayoutStateId(state: DiagramLayoutState) {
 
     switch (state.layoutMethod) {
         case "layered":
-            layoutMethodSegment = `${state.placementLayered}`;
+            layoutMethodSegment = `${state.placementLayered}-${state.layeringLayered}`;
             break;
         case "freese":
             layoutMethodSegment = ``;
@@ -44,6 +44,11 @@ export function createDiagramLayoutStateId(state: DiagramLayoutState) {
         case "redraw":
             layoutMethodSegment = `${state.targetDimensionReDraw}-${state.parallelizeReDraw}-${state.seedReDraw}`;
             break;
+        case "multilevel":
+            layoutMethodSegment = state.engineMultilevel === "redraw" ?
+                `${state.engineMultilevel}-${state.targetDimensionReDraw}-${state.parallelizeReDraw}-${state.seedReDraw}` :
+                `${state.engineMultilevel}`;
+            break;
     }
 
     return `${start}-${state.layoutMethod}-${state.layoutMethod}-${layoutMethodSegment}`;
@@ -70,6 +70,9 @@ function withResult(newState: Partial<ExportContextStore>, oldState: ExportConte
         case "csv":
             ({ lines: result, collapseRegions: collapseRegions } = convertToCsv(context, csvSeparator));
             break;
+        case "project":
+            // Project files are binary, they are written only when downloaded
+            break;
     }
 
     return {
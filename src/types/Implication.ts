@@ -0,0 +1,9 @@
+export type Implications = ReadonlyArray<Implication>
+
+/**
+ * Implication between sets of attributes, the conclusion does not contain the attributes of the premise.
+ */
+export type Implication = {
+    readonly premise: ReadonlyArray<number>,
+    readonly conclusion: ReadonlyArray<number>,
+}
\ No newline at end of file
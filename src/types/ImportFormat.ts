@@ -1 +1 @@
-export type ImportFormat = "burmeister" | "json" | "csv" | "xml"
\ No newline at end of file
+export type ImportFormat = "burmeister" | "json" | "csv" | "xml" | "project"
\ No newline at end of file
@@ -0,0 +1,8 @@
+// Heap usage of a single computation stage of the WebAssembly module
+export type MemoryUsage = {
+    // Total number of bytes allocated by the stage, including the memory that has been freed since
+    allocatedBytes: number,
+    // Highest number of bytes held by the stage at once
+    peakBytes: number,
+    allocationsCount: number,
+}
\ No newline at end of file
@@ -0,0 +1,5 @@
+export type ConvergenceCriteria = {
+    maxDisplacement: number,
+    energyDelta: number,
+    timeBudget: number,
+}
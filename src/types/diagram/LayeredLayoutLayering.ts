@@ -0,0 +1 @@
+export type LayeredLayoutLayering = "longestPath" | "coffmanGraham" | "networkSimplex";
\ No newline at end of file
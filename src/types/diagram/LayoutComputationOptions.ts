@@ -1,5 +1,7 @@
+import { LayeredLayoutLayering } from "./LayeredLayoutLayering";
 import { LayeredLayoutPlacement } from "./LayeredLayoutPlacement";
 import { LayoutMethod } from "./LayoutMethod";
+import { MultilevelLayoutEngine } from "./MultilevelLayoutEngine";
 
 export type LayoutComputationOptions = {
     layoutMethod: LayoutMethod,
@@ -7,4 +9,6 @@ export type LayoutComputationOptions = {
     parallelizeReDraw: boolean,
     seedReDraw: string,
     placementLayered: LayeredLayoutPlacement,
+    layeringLayered: LayeredLayoutLayering,
+    engineMultilevel: MultilevelLayoutEngine,
 }
\ No newline at end of file
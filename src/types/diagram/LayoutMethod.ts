@@ -1 +1 @@
-export type LayoutMethod = "layered" | "freese" | "redraw"
\ No newline at end of file
+export type LayoutMethod = "layered" | "freese" | "redraw" | "multilevel"
\ No newline at end of file
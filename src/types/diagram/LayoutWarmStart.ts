@@ -0,0 +1,6 @@
+export type LayoutWarmStart = {
+    // Coordinates of the previous layout, three values per concept
+    previousLayout: Float32Array,
+    // New index of each concept of the previous layout, -1 if the concept is not present anymore
+    newIndexes: Int32Array,
+}
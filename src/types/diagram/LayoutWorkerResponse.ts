@@ -1,4 +1,5 @@
 import { Point } from "../Point"
+import { MemoryUsage } from "../MemoryUsage"
 
 export type LayoutWorkerResponse = LayoutWorkerProgressResponse | LayoutWorkerResultResponse
 
@@ -11,4 +12,5 @@ export type LayoutWorkerResultResponse = {
     type: "result",
     layout: Array<Point>,
     computationTime: number,
+    memoryUsage: MemoryUsage,
 }
\ No newline at end of file
@@ -0,0 +1 @@
+export type MultilevelLayoutEngine = "freese" | "redraw";
\ No newline at end of file
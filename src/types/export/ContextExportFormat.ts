@@ -1 +1 @@
-export type ContextExportFormat = "burmeister" | "json" | "xml" | "csv"
\ No newline at end of file
+export type ContextExportFormat = "burmeister" | "json" | "xml" | "csv" | "project"
\ No newline at end of file
@@ -1,6 +1,7 @@
 import { ConceptLattice } from "../ConceptLattice";
 import { CsvSeparator } from "../CsvSeparator";
 import { LayoutComputationOptions } from "../diagram/LayoutComputationOptions";
+import { LayoutWarmStart } from "../diagram/LayoutWarmStart";
 import { FormalConcepts } from "../FormalConcepts";
 import { FormalContext } from "../FormalContext";
 import { ImportFormat } from "../ImportFormat";
@@ -14,7 +15,8 @@ export type CompleteMainWorkerRequest = {
 
 export type ContextParsingRequest = {
     type: "parse-context",
-    content: string,
+    // Project files are binary
+    content: string | ArrayBuffer,
     format: ImportFormat,
     csvSeparator?: CsvSeparator,
 } & BaseRequest
@@ -44,8 +46,10 @@ export type CompleteLayoutComputationRequest = {
     supremum: number,
     infimum: number,
     conceptsCount: number,
-    subconceptsMappingArrayBuffer: Int32Array,
+    // Omitted when the layout worker already holds a session of the same lattice
+    subconceptsMappingArrayBuffer?: Int32Array,
     options: LayoutComputationOptions,
+    warmStart?: LayoutWarmStart,
 } & BaseRequest
 
 type BaseRequest = {
@@ -3,6 +3,7 @@ import { ConceptLattice } from "../ConceptLattice";
 import { FormalConcepts } from "../FormalConcepts";
 import { ConceptLatticeLayout } from "../ConceptLatticeLayout";
 import { CompleteMainWorkerRequest } from "./MainWorkerRequest";
+import { MemoryUsage } from "../MemoryUsage";
 
 export type MainWorkerResponse = ErrorResponse | FinishedResponse | StatusResponse | ProgressResponse | ContextParsingResponse | ConceptComputationResponse | LatticeComputationResponse | LayoutComputationResponse | WorkerDataRequestResponse
 
@@ -34,18 +35,21 @@ export type ConceptComputationResponse = {
     type: "concepts",
     concepts: FormalConcepts,
     computationTime?: number,
+    memoryUsage?: MemoryUsage,
 } & BaseResponse
 
 export type LatticeComputationResponse = {
     type: "lattice",
     lattice: ConceptLattice,
     computationTime?: number,
+    memoryUsage?: MemoryUsage,
 } & BaseResponse
 
 export type LayoutComputationResponse = {
     type: "layout",
     layout: ConceptLatticeLayout,
     computationTime?: number,
+    memoryUsage?: MemoryUsage,
 } & BaseResponse
 
 
@@ -1,5 +1,6 @@
-import { FloatArray, FormalConceptArray, SimpleFormalConceptArray, IntArray, IntMultiArray, MainModule, StringArray, UIntArray } from "../cpp";
+import { CompressedFormalConceptArray, FloatArray, FormalConceptArray, SimpleFormalConceptArray, ImplicationArray, IntArray, IntMultiArray, MainModule, StringArray, UIntArray } from "../cpp";
 import { FormalConcept, FormalConcepts } from "../types/FormalConcepts";
+import { Implication } from "../types/Implication";
 import { createPoint, Point } from "../types/Point";
 
 export function* cppStringArrayToJs(cppArray: StringArray, shouldDelete: boolean = false): Generator<string> {
@@ -44,7 +45,7 @@ export function* cppIntMultiArrayToJs(cppArray: IntMultiArray, shouldDelete: boo
     }
 }
 
-export function* cppFormalConceptArrayToJs(cppArray: FormalConceptArray, shouldDelete: boolean = false): Generator<FormalConcept> {
+export function* cppFormalConceptArrayToJs(cppArray: FormalConceptArray | CompressedFormalConceptArray, shouldDelete: boolean = false): Generator<FormalConcept> {
     for (let i = 0; i < cppArray.size(); i++) {
         const value = cppArray.get(i)!;
 
@@ -66,6 +67,27 @@ export function* cppFormalConceptArrayToJs(cppArray: FormalConceptArray, shouldD
     }
 }
 
+export function* cppImplicationArrayToJs(cppArray: ImplicationArray, shouldDelete: boolean = false): Generator<Implication> {
+    for (let i = 0; i < cppArray.size(); i++) {
+        const value = cppArray.get(i)!;
+
+        const result: Implication = {
+            premise: [...cppIntArrayToJs(value.premise, shouldDelete)],
+            conclusion: [...cppIntArrayToJs(value.conclusion, shouldDelete)],
+        };
+
+        if (shouldDelete) {
+            value.delete();
+        }
+
+        yield result;
+    }
+
+    if (shouldDelete) {
+        cppArray.delete();
+    }
+}
+
 export function cppFloatArrayToPoints(cppArray: FloatArray, conceptsCount: number, shouldDelete: boolean = false): Array<Point> {
     const result = new Array<Point>();
 
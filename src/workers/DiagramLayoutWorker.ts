@@ -2,11 +2,18 @@ import { LayoutWorkerProgressResponse, LayoutWorkerResultResponse } from "../typ
 import { Point } from "../types/Point";
 import { CompleteLayoutComputationRequest } from "../types/workers/MainWorkerRequest";
 import { hashString } from "../utils/string";
+import { LayoutSession } from "../cpp";
+import { MemoryUsage } from "../types/MemoryUsage";
+
+// The worker is reused for all layouts of the same lattice,
+// so the session with the converted cover relation is kept between the computations
+let session: LayoutSession | null = null;
 
 self.onmessage = async (event: MessageEvent<CompleteLayoutComputationRequest>) => {
     let result: {
         layout: Array<Point>,
         computationTime: number,
+        memoryUsage: MemoryUsage,
     };
 
     try {
@@ -22,38 +29,45 @@ self.onmessage = async (event: MessageEvent<CompleteLayoutComputationRequest>) =
         type: "result",
         layout: result.layout,
         computationTime: result.computationTime,
+        memoryUsage: result.memoryUsage,
     };
 
     self.postMessage(response);
-    self.close();
 }
 
 async function computeLayout(request: CompleteLayoutComputationRequest) {
     const { computeLayeredLayout } = await import("../services/layouts/layeredLayout");
     const { computeFreeseLayout } = await import("../services/layouts/freeseLayout");
     const { computeReDrawLayout } = await import("../services/layouts/reDrawLayout");
+    const { computeMultilevelLayout } = await import("../services/layouts/multilevelLayout");
+    const layoutSession = await getLayoutSession(request);
 
     switch (request.options.layoutMethod) {
         case "layered":
             return await computeLayeredLayout(
-                request.conceptsCount,
-                request.supremum,
-                request.subconceptsMappingArrayBuffer,
+                layoutSession,
                 request.options.placementLayered,
+                request.options.layeringLayered,
                 postProgressMessage);
         case "freese":
             return await computeFreeseLayout(
-                request.conceptsCount,
-                request.supremum,
-                request.infimum,
-                request.subconceptsMappingArrayBuffer,
-                postProgressMessage);
+                layoutSession,
+                postProgressMessage,
+                undefined,
+                request.warmStart);
         case "redraw":
             return await computeReDrawLayout(
-                request.conceptsCount,
-                request.supremum,
-                request.infimum,
-                request.subconceptsMappingArrayBuffer,
+                layoutSession,
+                hashString(request.options.seedReDraw),
+                request.options.targetDimensionReDraw,
+                request.options.parallelizeReDraw,
+                postProgressMessage,
+                undefined,
+                request.warmStart);
+        case "multilevel":
+            return await computeMultilevelLayout(
+                layoutSession,
+                request.options.engineMultilevel,
                 hashString(request.options.seedReDraw),
                 request.options.targetDimensionReDraw,
                 request.options.parallelizeReDraw,
@@ -63,6 +77,27 @@ async function computeLayout(request: CompleteLayoutComputationRequest) {
     }
 }
 
+async function getLayoutSession(request: CompleteLayoutComputationRequest) {
+    // The cover relation is sent only when the lattice differs from the lattice of the current session
+    if (request.subconceptsMappingArrayBuffer) {
+        const { createLayoutSession } = await import("../services/layouts/layoutSession");
+
+        session?.delete();
+        session = null;
+        session = await createLayoutSession(
+            request.conceptsCount,
+            request.supremum,
+            request.infimum,
+            request.subconceptsMappingArrayBuffer);
+    }
+
+    if (!session) {
+        throw new Error("Layout session has not been created");
+    }
+
+    return session;
+}
+
 function postProgressMessage(progress: number) {
     const progressResponse: LayoutWorkerProgressResponse = {
         type: "progress",
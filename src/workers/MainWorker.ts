@@ -11,10 +11,22 @@ import { CsvSeparator } from "../types/CsvSeparator";
 import { calculateConeConceptIndexes, calculateSublattice } from "../services/lattice";
 import { LayoutComputationOptions } from "../types/diagram/LayoutComputationOptions";
 import { LayoutWorkerResponse } from "../types/diagram/LayoutWorkerResponse";
+import { ConceptLatticeLayout } from "../types/ConceptLatticeLayout";
+import { LayoutWarmStart } from "../types/diagram/LayoutWarmStart";
+import { MemoryUsage } from "../types/MemoryUsage";
+import { getProjectLayoutKey } from "../services/projectFile";
 
 let formalContext: FormalContext | null = null;
 let formalConcepts: FormalConcepts | null = null;
 let conceptLattice: ConceptLattice | null = null;
+// The last computed layout is used to warm start the next layout of the same lattice.
+// Each imported context gets a new worker, so a layout is never reused for the lattice of another (e.g. filtered) context,
+// that would need matching of the concepts of both lattices by their extents or intents.
+let lastLayout: { layout: ConceptLatticeLayout, options: LayoutComputationOptions } | null = null;
+// Layouts of the whole lattice stored in an opened project file, identified by the options they were computed with
+let projectLayouts: Map<string, ConceptLatticeLayout> = new Map();
+// The layout worker is reused while the lattice stays the same, it keeps a session of the (sub)lattice identified by the key
+let layoutWorker: { worker: Worker, sessionKey: string | null } | null = null;
 const workerInstances = new Map<number, { worker: Worker, reject?: (reason?: any) => void }>();
 
 self.onmessage = async (event: MessageEvent<CompleteMainWorkerRequest>) => {
@@ -31,6 +43,10 @@ self.onmessage = async (event: MessageEvent<CompleteMainWorkerRequest>) => {
                     workerInstance.worker.terminate();
                     workerInstances.delete(event.data.jobId);
                     workerInstance.reject?.();
+
+                    if (layoutWorker?.worker === workerInstance.worker) {
+                        layoutWorker = null;
+                    }
                 }
                 return;
             case "parse-context":
@@ -85,7 +101,7 @@ self.onmessage = async (event: MessageEvent<CompleteMainWorkerRequest>) => {
 };
 
 
-async function parseFileContent(jobId: number, fileContent: string, format: ImportFormat, separator?: CsvSeparator) {
+async function parseFileContent(jobId: number, fileContent: string | ArrayBuffer, format: ImportFormat, separator?: CsvSeparator) {
     postStatusMessage(jobId, "Parsing file");
 
     if (formalContext) {
@@ -96,11 +112,14 @@ async function parseFileContent(jobId: number, fileContent: string, format: Impo
     // https://www.audjust.com/blog/wasm-and-workers
     const { parseFileContent } = await tryThrow(import("../services/parsing"), "Scripts could not be loaded.");
 
-    const { context, concepts, lattice } = await parseFileContent(fileContent, format, separator);
+    const { context, concepts, lattice, layouts } = await parseFileContent(fileContent, format, separator);
 
     formalContext = context;
     formalConcepts = concepts || null;
     conceptLattice = lattice || null;
+    projectLayouts = new Map(layouts?.map(({ key, layout }) => [key, layout] as const));
+    lastLayout = null;
+    resetLayoutWorker();
 
     self.postMessage(createContextParsingResponse(jobId, formalContext));
 }
@@ -115,11 +134,11 @@ async function calculateConcepts(jobId: number, context: FormalContext) {
 
     const { computeConcepts } = await tryThrow(import("../services/concepts"), "Scripts could not be loaded.");
 
-    const { concepts, computationTime } = await tryThrow(
+    const { concepts, computationTime, memoryUsage } = await tryThrow(
         computeConcepts(context, (progress) => postProgressMessage(jobId, progress)),
         "Concept computation failed");
     formalConcepts = concepts;
-    self.postMessage(createConceptComputationResponse(jobId, formalConcepts, computationTime));
+    self.postMessage(createConceptComputationResponse(jobId, formalConcepts, computationTime, memoryUsage));
 }
 
 async function calculateLattice(jobId: number, concepts: FormalConcepts, context: FormalContext) {
@@ -132,11 +151,13 @@ async function calculateLattice(jobId: number, concepts: FormalConcepts, context
 
     const { conceptsToLattice } = await tryThrow(import("../services/lattice"), "Scripts could not be loaded.");
 
-    const { lattice, computationTime } = await tryThrow(
+    const { lattice, computationTime, memoryUsage } = await tryThrow(
         conceptsToLattice(concepts, context, (progress) => postProgressMessage(jobId, progress)),
         "Lattice computation failed");
     conceptLattice = lattice;
-    self.postMessage(createLatticeComputationResponse(jobId, conceptLattice, computationTime));
+    lastLayout = null;
+    resetLayoutWorker();
+    self.postMessage(createLatticeComputationResponse(jobId, conceptLattice, computationTime, memoryUsage));
 }
 
 async function calculateLayout(
@@ -149,10 +170,46 @@ async function calculateLayout(
 ) {
     postStatusMessage(jobId, "Computing layout");
 
-    const worker = new DiagramLayoutWorker();
-    const { request, reverseIndexMapping } = createCompleteLayoutComputationRequest(concepts, lattice, upperConeOnlyConceptIndex, lowerConeOnlyConceptIndex, options);
+    const projectLayout = upperConeOnlyConceptIndex === null && lowerConeOnlyConceptIndex === null ?
+        projectLayouts.get(getProjectLayoutKey(options)) :
+        undefined;
 
-    worker.postMessage(request, [request.subconceptsMappingArrayBuffer.buffer]);
+    if (projectLayout) {
+        const layoutMessage: LayoutComputationResponse = {
+            jobId,
+            time: new Date().getTime(),
+            type: "layout",
+            layout: projectLayout,
+        };
+        lastLayout = { layout: projectLayout, options };
+        self.postMessage(layoutMessage);
+        return;
+    }
+
+    if (!layoutWorker) {
+        layoutWorker = { worker: new DiagramLayoutWorker(), sessionKey: null };
+    }
+
+    const worker = layoutWorker.worker;
+    const sessionKey = `${upperConeOnlyConceptIndex};${lowerConeOnlyConceptIndex}`;
+    const { request, reverseIndexMapping } = createCompleteLayoutComputationRequest(
+        concepts,
+        lattice,
+        upperConeOnlyConceptIndex,
+        lowerConeOnlyConceptIndex,
+        options,
+        layoutWorker.sessionKey !== sessionKey);
+    const transfer: Array<Transferable> = [];
+
+    if (request.subconceptsMappingArrayBuffer) {
+        transfer.push(request.subconceptsMappingArrayBuffer.buffer);
+    }
+    if (request.warmStart) {
+        transfer.push(request.warmStart.previousLayout.buffer, request.warmStart.newIndexes.buffer);
+    }
+
+    worker.postMessage(request, transfer);
+    layoutWorker.sessionKey = sessionKey;
 
     await tryThrow(new Promise((resolve, reject) => {
         workerInstances.set(jobId, { worker, reject });
@@ -166,13 +223,16 @@ async function calculateLayout(
 
                     break;
                 case "result":
+                    const layout = getValidLayout(response.layout, reverseIndexMapping);
                     const layoutMessage: LayoutComputationResponse = {
                         jobId,
                         time: new Date().getTime(),
                         type: "layout",
-                        layout: getValidLayout(response.layout, reverseIndexMapping),
+                        layout,
                         computationTime: response.computationTime,
+                        memoryUsage: response.memoryUsage,
                     };
+                    lastLayout = { layout, options };
                     self.postMessage(layoutMessage);
 
                     workerInstances.delete(jobId);
@@ -182,11 +242,21 @@ async function calculateLayout(
         };
         worker.onerror = (event) => {
             workerInstances.delete(jobId);
+
+            if (layoutWorker?.worker === worker) {
+                layoutWorker = null;
+            }
+
             reject(event.message);
         };
     }), "Diagram layout computation failed");
 }
 
+function resetLayoutWorker() {
+    layoutWorker?.worker.terminate();
+    layoutWorker = null;
+}
+
 function postStatusMessage(jobId: number, message: string | null) {
     const statusResponse: StatusResponse = {
         jobId,
@@ -239,23 +309,25 @@ function createContextParsingResponse(jobId: number, context: FormalContext): Co
     };
 }
 
-function createConceptComputationResponse(jobId: number, concepts: FormalConcepts, computationTime?: number): ConceptComputationResponse {
+function createConceptComputationResponse(jobId: number, concepts: FormalConcepts, computationTime?: number, memoryUsage?: MemoryUsage): ConceptComputationResponse {
     return {
         jobId,
         time: new Date().getTime(),
         type: "concepts",
         concepts,
         computationTime,
+        memoryUsage,
     };
 }
 
-function createLatticeComputationResponse(jobId: number, lattice: ConceptLattice, computationTime?: number): LatticeComputationResponse {
+function createLatticeComputationResponse(jobId: number, lattice: ConceptLattice, computationTime?: number, memoryUsage?: MemoryUsage): LatticeComputationResponse {
     return {
         jobId,
         time: new Date().getTime(),
         type: "lattice",
         lattice,
         computationTime,
+        memoryUsage,
     };
 }
 
@@ -265,6 +337,7 @@ function createCompleteLayoutComputationRequest(
     upperConeOnlyConceptIndex: number | null,
     lowerConeOnlyConceptIndex: number | null,
     options: LayoutComputationOptions,
+    includeSubconceptsMapping: boolean,
 ): {
     request: CompleteLayoutComputationRequest,
     reverseIndexMapping: Map<number, number> | null,
@@ -280,7 +353,10 @@ function createCompleteLayoutComputationRequest(
                 conceptsCount: concepts.length,
                 supremum: getSupremum(concepts).index,
                 infimum: getInfimum(concepts).index,
-                subconceptsMappingArrayBuffer: new Int32Array(lattice.subconceptsMapping.flatMap((set) => [set.size, ...set])),
+                subconceptsMappingArrayBuffer: includeSubconceptsMapping ?
+                    new Int32Array(lattice.subconceptsMapping.flatMap((set) => [set.size, ...set])) :
+                    undefined,
+                warmStart: createLayoutWarmStart(options, null),
             },
             reverseIndexMapping: null,
         };
@@ -295,12 +371,59 @@ function createCompleteLayoutComputationRequest(
             conceptsCount: subconceptsMapping.length,
             supremum,
             infimum,
-            subconceptsMappingArrayBuffer: new Int32Array(subconceptsMapping.flatMap((set) => [set.size, ...set])),
+            subconceptsMappingArrayBuffer: includeSubconceptsMapping ?
+                new Int32Array(subconceptsMapping.flatMap((set) => [set.size, ...set])) :
+                undefined,
+            warmStart: createLayoutWarmStart(options, reverseIndexMapping),
         },
         reverseIndexMapping,
     };
 }
 
+function createLayoutWarmStart(options: LayoutComputationOptions, reverseIndexMapping: Map<number, number> | null): LayoutWarmStart | undefined {
+    if (!lastLayout || !canBeWarmStarted(lastLayout.options, options)) {
+        return undefined;
+    }
+
+    const indexMapping = new Map<number, number>();
+
+    if (reverseIndexMapping !== null) {
+        for (const [index, conceptIndex] of reverseIndexMapping) {
+            indexMapping.set(conceptIndex, index);
+        }
+    }
+
+    const previousLayout = new Float32Array(lastLayout.layout.length * 3);
+    const newIndexes = new Int32Array(lastLayout.layout.length);
+
+    for (let i = 0; i < lastLayout.layout.length; i++) {
+        const point = lastLayout.layout[i];
+
+        previousLayout[i * 3] = point.x;
+        previousLayout[i * 3 + 1] = point.y;
+        previousLayout[i * 3 + 2] = point.z;
+        newIndexes[i] = reverseIndexMapping === null ?
+            point.conceptIndex :
+            indexMapping.get(point.conceptIndex) ?? -1;
+    }
+
+    return { previousLayout, newIndexes };
+}
+
+function canBeWarmStarted(previousOptions: LayoutComputationOptions, options: LayoutComputationOptions) {
+    switch (options.layoutMethod) {
+        case "freese":
+            return previousOptions.layoutMethod === "freese";
+        case "redraw":
+            return previousOptions.layoutMethod === "redraw" &&
+                previousOptions.seedReDraw === options.seedReDraw &&
+                previousOptions.targetDimensionReDraw === options.targetDimensionReDraw &&
+                previousOptions.parallelizeReDraw === options.parallelizeReDraw;
+        default:
+            return false;
+    }
+}
+
 function getValidLayout(layout: Array<Point>, reverseIndexMapping: Map<number, number> | null) {
     if (reverseIndexMapping === null) {
         return layout.map((point, index) => createConceptPoint(point[0], point[1], point[2], index));
@@ -342,6 +465,7 @@ function tryGetIncomingData(event: MessageEvent<CompleteMainWorkerRequest>) {
     }
     if (event.data.lattice) {
         conceptLattice = event.data.lattice;
+        resetLayoutWorker();
     }
 }
 
@@ -0,0 +1,51 @@
+// Project file written by the CLI for the digits dataset, encoded in base64:
+//   konlatt-cli --format project --crossings-time-budget 0 ./datasets/digits.cxt
+//   base64 -w 100 ./datasets/digits.konlatt
+export const DIGITS_PROJECT_FILE_BASE64 = [
+    "S05MVAEAAAAFAAAAAAAAAAEAAAAAAAAAiAAAAAAAAABrAAAAAAAAAAIAAAAAAAAA+AAAAAAAAAA4AAAAAAAAAAMAAAAAAAAAMAEA",
+    "AAAAAAAUBwAAAAAAAAQAAAAAAAAASAgAAAAAAACoAgAAAAAAAAUAAAAAAAAA8AoAAAAAAABgAgAAAAAAAAoAAAAHAAAAAAAAAAYA",
+    "AAAHAAAACAAAAAkAAAAKAAAACwAAAAwAAAANAAAADgAAAA8AAAAQAAAAEQAAABIAAAATAAAAFAAAABUAAAAWAAAAFwAAAGRpZ2l0",
+    "czAxMjM0NTY3ODlhYmNkZWZnAAAAAAAKAAAABwAAACAAAAABAAAAfQAAAGAAAAA3AAAAZwAAAGoAAABPAAAAXgAAAGEAAAB/AAAA",
+    "awAAADAAAAAAAAAACgAAABEAAAAYAAAAHgAAACQAAAAsAAAANQAAADoAAAA/AAAAQwAAAEkAAABPAAAAUwAAAFYAAABaAAAAXgAA",
+    "AGAAAABiAAAAZQAAAGgAAABpAAAAawAAAG0AAABwAAAAcwAAAHYAAAB6AAAAfgAAAIAAAACDAAAAhgAAAIsAAACQAAAAlQAAAJoA",
+    "AACgAAAAowAAAKYAAACqAAAArAAAAK8AAACzAAAAtwAAALsAAADAAAAAwwAAAMcAAADOAAAAAAAAAAEAAAACAAAAAwAAAAQAAAAF",
+    "AAAABgAAAAcAAAAIAAAACQAAAAAAAAACAAAAAwAAAAUAAAAHAAAACAAAAAkAAAACAAAAAwAAAAQAAAAFAAAABgAAAAgAAAAJAAAA",
+    "AAAAAAIAAAADAAAABQAAAAYAAAAIAAAAAAAAAAQAAAAFAAAABgAAAAgAAAAJAAAAAAAAAAEAAAACAAAAAwAAAAQAAAAHAAAACAAA",
+    "AAkAAAAAAAAAAQAAAAMAAAAEAAAABQAAAAYAAAAHAAAACAAAAAkAAAACAAAAAwAAAAUAAAAIAAAACQAAAAAAAAACAAAAAwAAAAUA",
+    "AAAIAAAAAAAAAAUAAAAIAAAACQAAAAAAAAACAAAAAwAAAAcAAAAIAAAACQAAAAAAAAADAAAABQAAAAcAAAAIAAAACQAAAAIAAAAD",
+    "AAAABQAAAAgAAAAFAAAACAAAAAkAAAACAAAAAwAAAAgAAAAJAAAAAwAAAAUAAAAIAAAACQAAAAUAAAAIAAAAAgAAAAgAAAACAAAA",
+    "AwAAAAgAAAADAAAABQAAAAgAAAAIAAAAAwAAAAgAAAAIAAAACQAAAAMAAAAIAAAACQAAAAAAAAAFAAAACAAAAAAAAAACAAAACAAA",
+    "AAAAAAACAAAAAwAAAAgAAAAAAAAAAwAAAAUAAAAIAAAAAAAAAAgAAAAAAAAAAwAAAAgAAAAAAAAACAAAAAkAAAAAAAAAAwAAAAcA",
+    "AAAIAAAACQAAAAIAAAADAAAABQAAAAYAAAAIAAAABAAAAAUAAAAGAAAACAAAAAkAAAACAAAAAwAAAAQAAAAIAAAACQAAAAMAAAAE",
+    "AAAABQAAAAYAAAAIAAAACQAAAAUAAAAGAAAACAAAAAIAAAAGAAAACAAAAAMAAAAFAAAABgAAAAgAAAAGAAAACAAAAAQAAAAIAAAA",
+    "CQAAAAMAAAAEAAAACAAAAAkAAAAAAAAABQAAAAYAAAAIAAAAAAAAAAIAAAAGAAAACAAAAAAAAAADAAAABQAAAAYAAAAIAAAAAAAA",
+    "AAYAAAAIAAAAAAAAAAQAAAAIAAAACQAAAAAAAAABAAAAAwAAAAQAAAAHAAAACAAAAAkAAAAAAAAAAAAAAAEAAAACAAAAAwAAAAUA",
+    "AAAGAAAABwAAAAkAAAALAAAADgAAABAAAAASAAAAFQAAABkAAAAcAAAAHwAAACQAAAApAAAALQAAADEAAAA4AAAAPQAAAEIAAABG",
+    "AAAASgAAAE4AAABRAAAAVAAAAFoAAABeAAAAYgAAAGUAAABnAAAAagAAAGwAAABuAAAAcgAAAHUAAAB4AAAAfQAAAIEAAACEAAAA",
+    "hwAAAIkAAACLAAAAjwAAAJIAAACUAAAAAAAAAAEAAAACAAAAAwAAAAYAAAAFAAAABgAAAAAAAAABAAAAAAAAAAIAAAAAAAAAAwAA",
+    "AAYAAAAAAAAABQAAAAAAAAAGAAAAAAAAAAEAAAACAAAAAAAAAAEAAAADAAAABgAAAAAAAAABAAAABQAAAAAAAAABAAAABgAAAAAA",
+    "AAABAAAAAgAAAAMAAAAGAAAAAAAAAAEAAAACAAAABAAAAAUAAAAAAAAAAQAAAAIAAAAFAAAAAAAAAAEAAAACAAAABgAAAAAAAAAB",
+    "AAAAAgAAAAMAAAAEAAAABQAAAAYAAAAAAAAAAQAAAAIAAAAFAAAABgAAAAAAAAABAAAAAwAAAAUAAAAGAAAAAAAAAAEAAAAFAAAA",
+    "BgAAAAAAAAACAAAAAwAAAAYAAAAAAAAAAgAAAAQAAAAFAAAAAAAAAAIAAAAFAAAAAAAAAAIAAAAGAAAAAAAAAAIAAAADAAAABAAA",
+    "AAUAAAAGAAAAAAAAAAIAAAAFAAAABgAAAAAAAAADAAAABQAAAAYAAAAAAAAABQAAAAYAAAABAAAAAgAAAAEAAAADAAAABgAAAAEA",
+    "AAAFAAAAAQAAAAYAAAABAAAAAgAAAAMAAAAGAAAAAQAAAAIAAAAEAAAAAQAAAAIAAAAGAAAAAQAAAAIAAAADAAAABAAAAAYAAAAB",
+    "AAAAAwAAAAUAAAAGAAAAAQAAAAUAAAAGAAAAAgAAAAMAAAAGAAAAAgAAAAQAAAACAAAABgAAAAIAAAADAAAABAAAAAYAAAADAAAA",
+    "BQAAAAYAAAAFAAAABgAAAAAAAAAwAAAAAAAAAAUAAAAJAAAADQAAABEAAAAVAAAAGAAAAB0AAAAgAAAAIwAAACYAAAApAAAALQAA",
+    "AC8AAAAxAAAAMwAAADYAAAA3AAAAOAAAADoAAAA8AAAAPAAAAD0AAAA+AAAAQAAAAEIAAABEAAAARwAAAEoAAABLAAAATQAAAE8A",
+    "AABSAAAAVQAAAFgAAABaAAAAXgAAAGAAAABiAAAAZAAAAGUAAABmAAAAaAAAAGsAAABuAAAAcQAAAHMAAAB1AAAAeAAAAAEAAAAC",
+    "AAAAAwAAAAUAAAAGAAAABwAAAAgAAAAKAAAACwAAAAcAAAAgAAAAIgAAACMAAAAIAAAAIAAAACsAAAAsAAAACQAAACEAAAAqAAAA",
+    "LgAAAAoAAAAiAAAALwAAAAQAAAALAAAAIwAAACwAAAAvAAAADAAAAA4AAAAPAAAADAAAABoAAAAbAAAADQAAABgAAAAeAAAADgAA",
+    "ABoAAAAfAAAACQAAAA8AAAAbAAAAHwAAABIAAAATAAAAEAAAABYAAAASAAAAFwAAAA0AAAATAAAAFwAAABQAAAAUAAAAEQAAABUA",
+    "AAAQAAAAFQAAABQAAAAUAAAAFQAAABYAAAAQAAAAHAAAABEAAAAcAAAAEgAAABkAAAAdAAAAEwAAABgAAAAdAAAAFAAAABUAAAAc",
+    "AAAAFgAAABwAAAAXAAAAHQAAAB4AAAAMAAAAJQAAACYAAAANAAAAJAAAACgAAAAOAAAAKQAAAA8AAAAhAAAAJgAAACkAAAAQAAAA",
+    "JwAAABEAAAAnAAAAEwAAACQAAAAUAAAAFgAAABcAAAAoAAAAGAAAACQAAAAtAAAAGQAAACUAAAAtAAAAGwAAACYAAAAqAAAAHAAA",
+    "ACcAAAAeAAAAKAAAAB8AAAApAAAALgAAADAAAAAWAAAAbGF5ZXJlZDtiaztsb25nZXN0UGF0aAAAAACAvwAAQEAAAAAAAAAgQAAA",
+    "AEAAAAAAAAAAwAAAAEAAAAAAAABgQAAAAEAAAAAAAADwwAAAgD8AAAAAAACAvwAAAEAAAAAAAACgwAAAAEAAAAAAAABAQAAAgD8A",
+    "AAAAAADAQAAAgD8AAAAAAADAwAAAAIAAAAAAAACgQAAAgD8AAAAAAACAwAAAgD8AAAAAAACAQAAAAIAAAAAAAADgwAAAgL8AAAAA",
+    "AAAAQAAAAIAAAAAAAAAAwAAAAIAAAAAAAACQwAAAAMAAAAAAAAAAQQAAAMAAAAAAAADAQAAAgL8AAAAAAAAAQAAAgL8AAAAAAAAA",
+    "QAAAQMAAAAAAAACgQAAAAMAAAAAAAADAwAAAAMAAAAAAAAAgwAAAgL8AAAAAAABgwAAAgL8AAAAAAAAYQQAAgL8AAAAAAAAIQQAA",
+    "AIAAAAAAAACAPwAAAIAAAAAAAAAAQAAAAMAAAAAAAACQQAAAgL8AAAAAAACQwAAAgL8AAAAAAAAAAAAAAIAAAAAAAACAQAAAgD8A",
+    "AAAAAAAYwQAAAIAAAAAAAADAvwAAgD8AAAAAAADAwAAAgD8AAAAAAACwwAAAgL8AAAAAAADgQAAAAIAAAAAAAACAvwAAAIAAAAAA",
+    "AACAPwAAAMAAAAAAAAAAwQAAgL8AAAAAAACQwAAAAIAAAAAAAABgwAAAAIAAAAAAAADgQAAAgD8AAAAAAAAAPwAAgD8AAAAAAAAA",
+    "PwAAgL8AAAAAAAAAwQAAAIAAAAAAAACgwAAAgD8AAAAA",
+].join("");
\ No newline at end of file
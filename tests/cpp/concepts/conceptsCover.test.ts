@@ -11,7 +11,7 @@ test.each<TestValue>([
     //NOM5SHUTTLE,
 ])("concepts cover", async (value) => {
     const module = await Module();
-    const context = module.parseBurmeister(value.fileContent);
+    const context = module.parseBurmeister(value.fileContent, false);
     const conceptsResult = new module.FormalConceptsTimedResult();
     module.inClose(conceptsResult, context.context, context.cellSize, context.cellsPerObject, context.objects.size(), context.attributes.size(), undefined);
     const latticeResult = new module.IntMultiArrayTimedResult();
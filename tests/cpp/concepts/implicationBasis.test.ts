@@ -0,0 +1,43 @@
+import { expect, test, describe } from "vitest";
+import Module from "../../../src/cpp";
+import { DIGITS, LATTICE, LIVEINWATER, TEALADY, TestValue } from "../../constants/flowTestValues";
+import { cppImplicationArrayToJs } from "../../../src/utils/cpp";
+
+const IMPLICATIONS_COUNTS = new Map<string, number>([
+    [DIGITS.title, 6],
+    [LATTICE.title, 17],
+    [LIVEINWATER.title, 10],
+    [TEALADY.title, 23],
+]);
+
+describe.each<TestValue>([
+    DIGITS,
+    LATTICE,
+    LIVEINWATER,
+    TEALADY,
+])("duquenneGuiguesBasis", (value) => {
+    test(`duquenneGuiguesBasis on ${value.title}`, async () => {
+        const module = await Module();
+        const context = module.parseBurmeister(value.fileContent, false);
+        const contextMatrix = context.context;
+        const result = new module.ImplicationsTimedResult();
+        module.duquenneGuiguesBasis(result, contextMatrix, context.cellSize, context.cellsPerObject, context.objects.size(), context.attributes.size(), undefined);
+        const implications = [...cppImplicationArrayToJs(result.value, true)];
+        expect(implications.length).toBe(IMPLICATIONS_COUNTS.get(value.title));
+
+        // Every implication has to hold in the context
+        for (const implication of implications) {
+            for (let object = 0; object < context.objects.size(); object++) {
+                const hasAttribute = (attribute: number) => module.formalContextHasAttribute(contextMatrix, context.cellSize, context.cellsPerObject, object, attribute);
+
+                if (implication.premise.every(hasAttribute)) {
+                    expect(implication.conclusion.every(hasAttribute)).toBe(true);
+                }
+            }
+        }
+
+        contextMatrix.delete();
+        context.delete();
+        result.delete();
+    }, 60000);
+});
\ No newline at end of file
@@ -1,6 +1,10 @@
 import { expect, test, describe } from "vitest";
 import Module from "../../../src/cpp";
-import { DIGITS, LATTICE, LIVEINWATER, TEALADY, TestValue } from "../../constants/flowTestValues";
+import { cppFormalConceptArrayToJs, jsArrayToCppUIntArray } from "../../../src/utils/cpp";
+import { computeConcepts } from "../../../src/services/concepts";
+import { parseFileContent } from "../../../src/services/parsing";
+import { FormalContext } from "../../../src/types/FormalContext";
+import { DIGITS, LATTICE, LIVEINWATER, MUSHROOMEP, TEALADY, TestValue } from "../../constants/flowTestValues";
 
 describe.each<TestValue>([
     DIGITS,
@@ -14,7 +18,7 @@ describe.each<TestValue>([
 ])("inClose", (value) => {
     test(`inClose on ${value.title}`, async () => {
         const module = await Module();
-        const context = module.parseBurmeister(value.fileContent);
+        const context = module.parseBurmeister(value.fileContent, false);
         const result = new module.FormalConceptsTimedResult();
         module.inClose(result, context.context, context.cellSize, context.cellsPerObject, context.objects.size(), context.attributes.size(), undefined);
         expect(result.value.size()).toBe(value.conceptsCount);
@@ -23,4 +27,106 @@ describe.each<TestValue>([
         result.value.delete();
         result.delete();
     }, 60000);
-});
\ No newline at end of file
+
+    test(`inCloseCompressed on ${value.title}`, async () => {
+        const module = await Module();
+        const context = module.parseBurmeister(value.fileContent, false);
+        const result = new module.FormalConceptsTimedResult();
+        const compressedResult = new module.CompressedFormalConceptsTimedResult();
+        module.inClose(result, context.context, context.cellSize, context.cellsPerObject, context.objects.size(), context.attributes.size(), undefined);
+        module.inCloseCompressed(compressedResult, context.context, context.cellSize, context.cellsPerObject, context.objects.size(), context.attributes.size(), undefined);
+        expect(compressedResult.value.size()).toBe(value.conceptsCount);
+        expect([...cppFormalConceptArrayToJs(compressedResult.value, true)]).toEqual([...cppFormalConceptArrayToJs(result.value, true)]);
+
+        context.delete();
+        result.delete();
+        compressedResult.delete();
+    }, 60000);
+});
+
+// Objects of the attributes of the synthetic context, they span two chunks of 65536 objects of the compressed extents
+// and produce array (sparse), bitmap (dense) and run (consecutive objects) containers
+const SYNTHETIC_ATTRIBUTES = [
+    (object: number) => object % 2 === 0,
+    (object: number) => object < 40000,
+    (object: number) => object % 3 === 0,
+    (object: number) => object % 1000 === 7,
+    (object: number) => object >= 60000,
+    (object: number) => (object * 7919) % 13 < 6,
+    (object: number) => Math.floor(object / 5000) % 2 === 1,
+];
+const SYNTHETIC_OBJECTS_COUNT = 70000;
+
+function createSyntheticContext(): FormalContext {
+    const context = new Array<number>(SYNTHETIC_OBJECTS_COUNT).fill(0);
+
+    for (let object = 0; object < SYNTHETIC_OBJECTS_COUNT; object++) {
+        SYNTHETIC_ATTRIBUTES.forEach((hasAttribute, attribute) => {
+            if (hasAttribute(object)) {
+                context[object] |= 1 << attribute;
+            }
+        });
+    }
+
+    return {
+        context,
+        objects: context.map((_, object) => `${object}`),
+        attributes: SYNTHETIC_ATTRIBUTES.map((_, attribute) => `${attribute}`),
+        cellsPerObject: 1,
+        cellSize: 32,
+    };
+}
+
+test("inCloseCompressed on mushroomep", async () => {
+    const module = await Module();
+    const context = module.parseBurmeister(MUSHROOMEP.fileContent, false);
+    const result = new module.FormalConceptsTimedResult();
+    const compressedResult = new module.CompressedFormalConceptsTimedResult();
+    module.inClose(result, context.context, context.cellSize, context.cellsPerObject, context.objects.size(), context.attributes.size(), undefined);
+    module.inCloseCompressed(compressedResult, context.context, context.cellSize, context.cellsPerObject, context.objects.size(), context.attributes.size(), undefined);
+    expect(compressedResult.value.size()).toBe(MUSHROOMEP.conceptsCount);
+
+    // The concepts are compared one by one, so that all of them do not have to be converted at once
+    const compressedConcepts = cppFormalConceptArrayToJs(compressedResult.value, true);
+
+    for (const concept of cppFormalConceptArrayToJs(result.value, true)) {
+        expect(compressedConcepts.next().value).toEqual(concept);
+    }
+    expect(compressedConcepts.next().done).toBe(true);
+
+    context.delete();
+    result.delete();
+    compressedResult.delete();
+}, 120000);
+
+test("inCloseCompressed on a synthetic context with more than 65536 objects", async () => {
+    const module = await Module();
+    const context = createSyntheticContext();
+    const uIntContext = jsArrayToCppUIntArray(module, context.context);
+    const result = new module.FormalConceptsTimedResult();
+    const compressedResult = new module.CompressedFormalConceptsTimedResult();
+    module.inClose(result, uIntContext, context.cellSize, context.cellsPerObject, context.objects.length, context.attributes.length, undefined);
+    module.inCloseCompressed(compressedResult, uIntContext, context.cellSize, context.cellsPerObject, context.objects.length, context.attributes.length, undefined);
+
+    const concepts = [...cppFormalConceptArrayToJs(result.value, true)];
+
+    expect(concepts.length).toBe(71);
+    expect([...cppFormalConceptArrayToJs(compressedResult.value, true)]).toEqual(concepts);
+
+    // Contexts with at least 4096 objects are computed with the compressed extents
+    const { concepts: computedConcepts } = await computeConcepts(context);
+
+    expect(computedConcepts).toEqual(concepts);
+
+    uIntContext.delete();
+    result.delete();
+    compressedResult.delete();
+}, 60000);
+
+test("concepts of mushroomep are computed with the compressed extents", async () => {
+    const { context } = await parseFileContent(MUSHROOMEP.fileContent, "burmeister");
+    const { concepts } = await computeConcepts(context);
+
+    expect(context.objects.length).toBeGreaterThanOrEqual(4096);
+    expect(concepts.length).toBe(MUSHROOMEP.conceptsCount);
+}, 120000);
\ No newline at end of file
@@ -2,6 +2,8 @@ import { expect, test } from "vitest";
 import Module from "../../../src/cpp";
 import { DIGITS, NOM10CRX, MUSHROOMEP } from "../../constants/flowTestValues";
 import { cppStringArrayToJs, cppUIntArrayToJs } from "../../../src/utils/cpp";
+import { parseFileContent } from "../../../src/services/parsing";
+import { INVALID_FILE_MESSAGE } from "../../../src/services/parsing/constants";
 
 const DIGITS_CONTEXT = [
     0b1111101,
@@ -21,7 +23,7 @@ const DIGITS_CELLS_PER_OBJECT = 1;
 
 test("digits context is parsed correctly", async () => {
     const module = await Module();
-    const context = module.parseBurmeister(DIGITS.fileContent);
+    const context = module.parseBurmeister(DIGITS.fileContent, false);
 
     expect([...cppUIntArrayToJs(context.context)]).toEqual(DIGITS_CONTEXT);
     expect([...cppStringArrayToJs(context.objects)]).toEqual(DIGITS_OBJECTS);
@@ -33,7 +35,7 @@ test("digits context is parsed correctly", async () => {
 
 test("nom10crx context is parsed", async () => {
     const module = await Module();
-    const context = module.parseBurmeister(NOM10CRX.fileContent);
+    const context = module.parseBurmeister(NOM10CRX.fileContent, false);
 
     expect(context.context.size() > 0).toBe(true);
     expect(context.objects.size()).toBe(653);
@@ -45,7 +47,7 @@ test("nom10crx context is parsed", async () => {
 
 test("mushroomep context is parsed", async () => {
     const module = await Module();
-    const context = module.parseBurmeister(MUSHROOMEP.fileContent);
+    const context = module.parseBurmeister(MUSHROOMEP.fileContent, false);
 
     expect(context.context.size() > 0).toBe(true);
     expect(context.objects.size()).toBe(8124);
@@ -53,4 +55,121 @@ test("mushroomep context is parsed", async () => {
     expect(context.cellsPerObject).toBe(4);
 
     context.delete();
+});
+
+const SYNTHETIC_OBJECTS_COUNT = 12000;
+const SYNTHETIC_ATTRIBUTES_COUNT = 100;
+const SYNTHETIC_CELLS_PER_OBJECT = 4;
+
+function hasSyntheticIncidence(object: number, attribute: number) {
+    return (object * 7 + attribute * 3) % 5 === 0 || (object + attribute) % 11 === 0;
+}
+
+// The cross table of the synthetic context is larger than 1 MiB, the threshold of the parallel parsing
+function createSyntheticContext(lineBreak: string) {
+    const lines = ["B", "", `${SYNTHETIC_OBJECTS_COUNT}`, `${SYNTHETIC_ATTRIBUTES_COUNT}`, ""];
+    const context = new Array<number>(SYNTHETIC_OBJECTS_COUNT * SYNTHETIC_CELLS_PER_OBJECT).fill(0);
+
+    for (let object = 0; object < SYNTHETIC_OBJECTS_COUNT; object++) {
+        lines.push(`object ${object}`);
+    }
+    for (let attribute = 0; attribute < SYNTHETIC_ATTRIBUTES_COUNT; attribute++) {
+        lines.push(`attribute ${attribute}`);
+    }
+    for (let object = 0; object < SYNTHETIC_OBJECTS_COUNT; object++) {
+        let row = "";
+
+        for (let attribute = 0; attribute < SYNTHETIC_ATTRIBUTES_COUNT; attribute++) {
+            if (hasSyntheticIncidence(object, attribute)) {
+                row += attribute % 2 === 0 ? "X" : "x";
+
+                const cell = object * SYNTHETIC_CELLS_PER_OBJECT + Math.floor(attribute / 32);
+                context[cell] = (context[cell] | (1 << (attribute % 32))) >>> 0;
+            }
+            else {
+                row += ".";
+            }
+        }
+
+        lines.push(row);
+    }
+
+    return { fileContent: lines.join(lineBreak), context };
+}
+
+test("synthetic context is parsed the same way in chunks", async () => {
+    const module = await Module();
+
+    for (const lineBreak of ["\n", "\r\n"]) {
+        const { fileContent, context } = createSyntheticContext(lineBreak);
+
+        expect(fileContent.length).toBeGreaterThan(1 << 20);
+
+        // The chunks run one after another when the module is built without threads
+        for (const chunksCount of [1, 2, 3, 8, 13]) {
+            const chunkedContext = module.parseBurmeisterInChunks(fileContent, chunksCount);
+
+            expect([...cppUIntArrayToJs(chunkedContext.context)]).toEqual(context);
+            expect(chunkedContext.objects.size()).toBe(SYNTHETIC_OBJECTS_COUNT);
+            expect(chunkedContext.attributes.size()).toBe(SYNTHETIC_ATTRIBUTES_COUNT);
+            expect(chunkedContext.cellsPerObject).toBe(SYNTHETIC_CELLS_PER_OBJECT);
+
+            chunkedContext.delete();
+        }
+    }
+});
+
+test("invalid rows are reported by all the chunks", async () => {
+    const module = await Module();
+    const { fileContent } = createSyntheticContext("\n");
+    const lastRowStart = fileContent.lastIndexOf("\n");
+    const middleRowStart = fileContent.indexOf("\n", fileContent.length / 2) + 1;
+
+    const withoutLastRow = fileContent.substring(0, lastRowStart);
+    const withInvalidRow = fileContent.substring(0, middleRowStart) + "?" + fileContent.substring(middleRowStart + 1);
+    const withShortRow = fileContent.substring(0, middleRowStart) + fileContent.substring(middleRowStart + 1);
+
+    for (const chunksCount of [1, 2, 3, 8]) {
+        expect(() => module.parseBurmeisterInChunks(withoutLastRow, chunksCount)).toThrow();
+        expect(() => module.parseBurmeisterInChunks(withInvalidRow, chunksCount)).toThrow();
+        expect(() => module.parseBurmeisterInChunks(withShortRow, chunksCount)).toThrow();
+    }
+});
+
+test("rows are trimmed and characters after the last attribute are ignored", async () => {
+    const { context } = await parseFileContent("B\r\n\r\n2\r\n3\r\n\r\na\r\nb\r\nx\r\ny\r\nz\r\n  X.x  \r\n..X comment\r\n\r\n", "burmeister");
+
+    expect(context.objects).toEqual(["a", "b"]);
+    expect(context.attributes).toEqual(["x", "y", "z"]);
+    expect(context.context).toEqual([0b101, 0b100]);
+});
+
+test("malformed files are reported", async () => {
+    const module = await Module();
+    const malformedFiles = [
+        // Missing row
+        ["B\n\n2\n2\n\na\nb\nx\ny\nX.", "Context could not be parsed."],
+        // Invalid character
+        ["B\n\n2\n2\n\na\nb\nx\ny\nX.\n?X", "Context could not be parsed."],
+        // Short row
+        ["B\n\n2\n2\n\na\nb\nx\ny\nX.\nX", "Context could not be parsed."],
+        // Empty row
+        ["B\n\n2\n2\n\na\nb\nx\ny\n\nX.", "Context could not be parsed."],
+        // Missing cross table
+        ["B\n\n2\n2\n\na\nb\nx\ny", "Attributes could not be parsed."],
+        // Missing attribute names
+        ["B\n\n2\n2\n\na\nb\nx", "Attributes could not be parsed."],
+        // Missing object names
+        ["B\n\n3\n2\n\na\nb", "Objects could not be parsed."],
+    ];
+
+    for (const [fileContent, message] of malformedFiles) {
+        const parsedContext = new module.ParsedContext();
+
+        expect(module.parseBurmeisterContext(parsedContext, fileContent, false)).toBe(message);
+        expect(() => module.parseBurmeister(fileContent, false)).toThrow();
+        await expect(parseFileContent(fileContent, "burmeister")).rejects.toThrow(`${INVALID_FILE_MESSAGE} ${message}`);
+
+        parsedContext.delete();
+    }
 });
\ No newline at end of file
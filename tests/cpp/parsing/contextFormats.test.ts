@@ -0,0 +1,61 @@
+import { expect, test } from "vitest";
+import innerPlanetsCsv from "../../../datasets/inner-planets.csv?raw";
+import innerPlanetsJson from "../../../datasets/inner-planets.json?raw";
+import innerPlanetsXml from "../../../datasets/inner-planets.xml?raw";
+import { parseFileContent } from "../../../src/services/parsing";
+import { INVALID_FILE_MESSAGE } from "../../../src/services/parsing/constants";
+
+const INNER_PLANETS_OBJECTS = ["Mercury", "Venus", "Earth", "Mars"];
+const INNER_PLANETS_ATTRIBUTES = ["Is_Terrestrial", "Has_Moons", "Is_Habitable", "Has_Dense_Atmosphere"];
+const INNER_PLANETS_CONTEXT = [0b0001, 0b1001, 0b1111, 0b0011];
+
+test("json context is parsed correctly", async () => {
+    const { context, concepts } = await parseFileContent(innerPlanetsJson, "json");
+
+    expect(context.name).toBe("Inner planets");
+    expect(context.objects).toEqual(INNER_PLANETS_OBJECTS);
+    expect(context.attributes).toEqual(INNER_PLANETS_ATTRIBUTES);
+    expect(context.context).toEqual(INNER_PLANETS_CONTEXT);
+    expect(context.cellsPerObject).toBe(1);
+    expect(concepts).toBeUndefined();
+});
+
+test("xml context is parsed correctly", async () => {
+    const { context } = await parseFileContent(innerPlanetsXml, "xml");
+
+    expect(context.name).toBe("Inner planets");
+    expect(context.objects).toEqual(INNER_PLANETS_OBJECTS);
+    expect(context.attributes).toEqual(INNER_PLANETS_ATTRIBUTES);
+    expect(context.context).toEqual(INNER_PLANETS_CONTEXT);
+});
+
+test("csv context is parsed correctly", async () => {
+    const { context } = await parseFileContent(innerPlanetsCsv, "csv", ",");
+
+    // Attributes are numbered in the order of their first occurrence
+    expect(context.objects).toEqual(INNER_PLANETS_OBJECTS);
+    expect(context.attributes).toEqual(["Is_Terrestrial", "Has_Dense_Atmosphere", "Has_Moons", "Is_Habitable"]);
+    expect(context.context).toEqual([0b0001, 0b0011, 0b1111, 0b0101]);
+});
+
+test("json concepts are parsed together with the context", async () => {
+    const { context, concepts } = await parseFileContent(`{
+        "objects": ["a", "b"],
+        "attributes": ["x"],
+        "concepts": [{ "objects": [0, 1], "attributes": [0] }]
+    }`, "json");
+
+    expect(context.objects).toEqual(["a", "b"]);
+    expect(concepts?.length).toBe(1);
+});
+
+test("invalid files are reported", async () => {
+    await expect(parseFileContent("a,b,c", "csv", ",")).rejects.toThrow(`${INVALID_FILE_MESSAGE} Invalid separator.`);
+    await expect(parseFileContent(`{ "objects": [], "attributes": ["x"], "relation": [] }`, "json"))
+        .rejects.toThrow(`${INVALID_FILE_MESSAGE} Objects are missing.`);
+    await expect(parseFileContent(`{ "objects": ["a"], "attributes": ["x"], "relation": [[0, 1]] }`, "json"))
+        .rejects.toThrow(`${INVALID_FILE_MESSAGE} Invalid relation format.`);
+    await expect(parseFileContent(`<context><objects><obj>a</obj></objects><attributes><attr>x</attr></attributes><relation><rel obj="0" /></relation></context>`, "xml"))
+        .rejects.toThrow(`${INVALID_FILE_MESSAGE} Invalid relation format.`);
+    await expect(parseFileContent(`{ "objects": [`, "json")).rejects.toThrow(INVALID_FILE_MESSAGE);
+});
\ No newline at end of file
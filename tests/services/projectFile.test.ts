@@ -0,0 +1,123 @@
+import { expect, test } from "vitest";
+import { getProjectLayoutKey, openProjectFile, writeProjectFile } from "../../src/services/projectFile";
+import { reverseMapping } from "../../src/services/lattice";
+import { FormalContext } from "../../src/types/FormalContext";
+import { FormalConcepts } from "../../src/types/FormalConcepts";
+import { createConceptPoint } from "../../src/types/diagram/ConceptPoint";
+import { parseFileContent } from "../../src/services/parsing";
+import { DIGITS } from "../constants/flowTestValues";
+import { DIGITS_PROJECT_FILE_BASE64 } from "../constants/projectFiles";
+
+const CONTEXT: FormalContext = {
+    name: "Příliš žluťoučký kůň",
+    context: [0b011, 0b110],
+    objects: ["a", "b"],
+    attributes: ["x", "y", "z"],
+    cellsPerObject: 1,
+    cellSize: 32,
+};
+
+const CONCEPTS: FormalConcepts = [
+    { index: 0, objects: [0, 1], attributes: [1] },
+    { index: 1, objects: [0], attributes: [0, 1] },
+    { index: 2, objects: [1], attributes: [1, 2] },
+    { index: 3, objects: [], attributes: [0, 1, 2] },
+];
+
+const SUBCONCEPTS_MAPPING = [new Set([1, 2]), new Set([3]), new Set([3]), new Set<number>()];
+
+test("project file is read as it was written", () => {
+    const layout = CONCEPTS.map((concept) => createConceptPoint(concept.index, concept.index * 2, 0.5, concept.index));
+    const buffer = writeProjectFile(
+        CONTEXT,
+        CONCEPTS,
+        {
+            subconceptsMapping: SUBCONCEPTS_MAPPING,
+            superconceptsMapping: reverseMapping(SUBCONCEPTS_MAPPING),
+            objectsLabeling: new Map(),
+            attributesLabeling: new Map(),
+        },
+        [{ key: "freese", layout }]);
+
+    const project = openProjectFile(buffer);
+
+    expect(project.hasContext()).toBe(true);
+    expect(project.hasConcepts()).toBe(true);
+    expect(project.hasLattice()).toBe(true);
+    expect(project.readContext()).toEqual(CONTEXT);
+    expect(project.readConcepts()).toEqual(CONCEPTS);
+
+    const lattice = project.readLattice(project.readConcepts());
+
+    expect(lattice.subconceptsMapping).toEqual(SUBCONCEPTS_MAPPING);
+    expect(lattice.superconceptsMapping).toEqual(reverseMapping(SUBCONCEPTS_MAPPING));
+    expect(project.readLayoutKeys()).toEqual(["freese"]);
+    expect(project.readLayout("freese")).toEqual(layout);
+    expect(project.readLayout("layered")).toBeUndefined();
+});
+
+test("project file without concepts contains only the context", () => {
+    const project = openProjectFile(writeProjectFile(CONTEXT));
+
+    expect(project.hasConcepts()).toBe(false);
+    expect(project.hasLattice()).toBe(false);
+    expect(project.readContext().objects).toEqual(CONTEXT.objects);
+    expect(() => project.readConcepts()).toThrow();
+});
+
+test("truncated project file is rejected", () => {
+    const buffer = writeProjectFile(CONTEXT, CONCEPTS);
+
+    expect(() => openProjectFile(buffer.slice(0, 10))).toThrow();
+    expect(() => openProjectFile(buffer.slice(0, buffer.byteLength - 8)).readConcepts()).toThrow();
+});
+
+test("project file written by the CLI is read", async () => {
+    const bytes = Uint8Array.from(atob(DIGITS_PROJECT_FILE_BASE64), (character) => character.charCodeAt(0));
+    const project = openProjectFile(bytes.buffer);
+    const { context } = await parseFileContent(DIGITS.fileContent, "burmeister");
+    const projectContext = project.readContext();
+
+    expect(projectContext).toEqual({ ...context, name: "digits" });
+
+    const concepts = project.readConcepts();
+    const hasAttribute = (object: number, attribute: number) =>
+        ((projectContext.context[object * projectContext.cellsPerObject + Math.floor(attribute / projectContext.cellSize)] >>> (attribute % projectContext.cellSize)) & 1) === 1;
+
+    expect(concepts.length).toBe(DIGITS.conceptsCount);
+
+    for (const concept of concepts) {
+        // The extent consists of all the objects that have all the attributes of the intent
+        const extent = projectContext.objects
+            .map((_, object) => object)
+            .filter((object) => concept.attributes.every((attribute) => hasAttribute(object, attribute)));
+
+        expect(concept.objects).toEqual(extent);
+    }
+
+    const lattice = project.readLattice(concepts);
+
+    expect(lattice.subconceptsMapping.reduce((size, subconcepts) => size + subconcepts.size, 0)).toBe(DIGITS.coverRelationSize);
+    expect(project.readLayoutKeys()).toEqual(["layered;bk;longestPath"]);
+    expect(project.readLayout("layered;bk;longestPath")?.length).toBe(DIGITS.conceptsCount);
+});
+
+test("project file written by the CLI is imported with its layout", async () => {
+    const bytes = Uint8Array.from(atob(DIGITS_PROJECT_FILE_BASE64), (character) => character.charCodeAt(0));
+    const { context, concepts, lattice, layouts } = await parseFileContent(bytes.buffer, "project");
+    const layoutKey = getProjectLayoutKey({
+        layoutMethod: "layered",
+        placementLayered: "bk",
+        layeringLayered: "longestPath",
+        targetDimensionReDraw: 3,
+        parallelizeReDraw: false,
+        seedReDraw: "42",
+        engineMultilevel: "freese",
+    });
+
+    expect(context.name).toBe("digits");
+    expect(concepts?.length).toBe(DIGITS.conceptsCount);
+    expect(lattice?.subconceptsMapping.length).toBe(DIGITS.conceptsCount);
+    expect(layouts?.map(({ key }) => key)).toEqual([layoutKey]);
+    expect(layouts?.[0].layout.length).toBe(DIGITS.conceptsCount);
+});
\ No newline at end of file